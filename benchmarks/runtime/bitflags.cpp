@@ -0,0 +1,122 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <enchantum/bitflags.hpp>
+#include <enchantum/bitwise_operators.hpp>
+#include <vector>
+
+enum class Wide : std::uint32_t {
+  F0 = 1u << 0, F1 = 1u << 1, F2 = 1u << 2, F3 = 1u << 3, F4 = 1u << 4, F5 = 1u << 5, F6 = 1u << 6, F7 = 1u << 7,
+  F8 = 1u << 8, F9 = 1u << 9, F10 = 1u << 10, F11 = 1u << 11, F12 = 1u << 12, F13 = 1u << 13, F14 = 1u << 14,
+  F15 = 1u << 15, F16 = 1u << 16, F17 = 1u << 17, F18 = 1u << 18, F19 = 1u << 19, F20 = 1u << 20, F21 = 1u << 21,
+  F22 = 1u << 22, F23 = 1u << 23, F24 = 1u << 24, F25 = 1u << 25, F26 = 1u << 26, F27 = 1u << 27, F28 = 1u << 28,
+  F29 = 1u << 29, F30 = 1u << 30, F31 = 1u << 31,
+};
+ENCHANTUM_DEFINE_BITWISE_FOR(Wide)
+
+enum class Scattered : std::uint64_t {
+  A = std::uint64_t{1} << 1, B = std::uint64_t{1} << 4, C = std::uint64_t{1} << 9, D = std::uint64_t{1} << 13,
+  E = std::uint64_t{1} << 20, F = std::uint64_t{1} << 27, G = std::uint64_t{1} << 33, H = std::uint64_t{1} << 40,
+  I = std::uint64_t{1} << 41, J = std::uint64_t{1} << 50, K = std::uint64_t{1} << 57, L = std::uint64_t{1} << 63,
+};
+ENCHANTUM_DEFINE_BITWISE_FOR(Scattered)
+
+enum class Narrow : std::uint8_t {
+  Read = 1 << 0, Write = 1 << 1, Execute = 1 << 2, Append = 1 << 3, Delete = 1 << 4, Owner = 1 << 5,
+};
+ENCHANTUM_DEFINE_BITWISE_FOR(Narrow)
+
+static_assert(enchantum::is_contiguous_bitflag<Wide>);
+static_assert(!enchantum::is_contiguous_bitflag<Scattered>);
+
+namespace {
+
+// what `to_string_bitflag` did before: test every flag against the value
+template<typename E>
+std::size_t every_flag_to_string(char* first, char* const last, const E value)
+{
+  using T          = std::underlying_type_t<E>;
+  const auto start = first;
+  T          check = 0;
+  for (std::size_t i = 0; i < enchantum::count<E>; ++i) {
+    const auto v = static_cast<T>(enchantum::values_generator<E>[i]);
+    if (v == (static_cast<T>(value) & v)) {
+      const auto s = enchantum::names_generator<E>[i];
+      if (first != start && first != last)
+        *first++ = '|';
+      for (std::size_t c = 0; c < s.size() && first != last; ++c)
+        *first++ = s[c];
+      check |= v;
+    }
+  }
+  return check == static_cast<T>(value) ? static_cast<std::size_t>(first - start) : 0;
+}
+
+// `bits_per_word` flags chosen pseudo randomly for every word
+template<typename E>
+std::vector<E> make_words(const std::size_t bits_per_word)
+{
+  using T = std::underlying_type_t<E>;
+  std::vector<E> words;
+  std::uint32_t  state = 12345;
+  for (int i = 0; i < 1024; ++i) {
+    T word = 0;
+    for (std::size_t b = 0; b < bits_per_word; ++b) {
+      state = state * 1664525u + 1013904223u;
+      word |= static_cast<T>(enchantum::values<E>[(state >> 16) % enchantum::count<E>]);
+    }
+    words.push_back(static_cast<E>(word));
+  }
+  return words;
+}
+
+template<typename E>
+void bench_words(const std::vector<E>& words, const char* const every_flag_name, const char* const set_bits_name)
+{
+  BENCHMARK(every_flag_name)
+  {
+    char        buffer[enchantum::max_bitflag_string_length<E>];
+    std::size_t size = 0;
+    for (const auto e : words)
+      size += every_flag_to_string(buffer, buffer + sizeof(buffer), e);
+    return size;
+  };
+
+  BENCHMARK(set_bits_name)
+  {
+    char        buffer[enchantum::max_bitflag_string_length<E>];
+    std::size_t size = 0;
+    for (const auto e : words)
+      size += static_cast<std::size_t>(enchantum::to_string_bitflag(buffer, buffer + sizeof(buffer), e).ptr - buffer);
+    return size;
+  };
+}
+
+} // namespace
+
+TEST_CASE("to_string_bitflag on contiguous flags", "[benchmark][bitflags]")
+{
+  bench_words(make_words<Wide>(2), "sparse words every flag", "sparse words set bits");
+  bench_words(make_words<Wide>(enchantum::count<Wide>), "dense words every flag", "dense words set bits");
+}
+
+TEST_CASE("to_string_bitflag on scattered flags", "[benchmark][bitflags]")
+{
+  bench_words(make_words<Scattered>(2), "sparse words every flag", "sparse words set bits");
+  bench_words(make_words<Scattered>(enchantum::count<Scattered>), "dense words every flag", "dense words set bits");
+}
+
+TEST_CASE("to_string_bitflag on few flags", "[benchmark][bitflags]")
+{
+  const auto words = make_words<Narrow>(3);
+  bench_words(words, "every flag", "buffer");
+
+  BENCHMARK("view")
+  {
+    std::size_t size = 0;
+    for (const auto e : words)
+      size += enchantum::to_string_bitflag_view(e).size();
+    return size;
+  };
+}
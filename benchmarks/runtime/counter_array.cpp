@@ -0,0 +1,66 @@
+#include <atomic>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <enchantum/array.hpp>
+#include <enchantum/counter_array.hpp>
+#include <thread>
+#include <vector>
+
+enum class RequestKind { Get, Put, Delete, List, Watch };
+
+namespace {
+
+constexpr int increments = 100000;
+
+// runs `f` on `threads` threads and waits for them
+template<typename Func>
+void run_threads(const std::size_t threads, Func f)
+{
+  std::vector<std::thread> workers;
+  for (std::size_t t = 0; t < threads; ++t)
+    workers.emplace_back(f);
+  for (auto& worker : workers)
+    worker.join();
+}
+
+} // namespace
+
+TEST_CASE("count from more threads than shards", "[benchmark][counter_array]")
+{
+  // twice as many threads as the small counter has shards
+  constexpr std::size_t shards  = 4;
+  const std::size_t     cores   = std::thread::hardware_concurrency();
+  const std::size_t     threads = cores > 2 * shards ? cores : 2 * shards;
+
+  BENCHMARK("enchantum::array of std::atomic")
+  {
+    static enchantum::array<RequestKind, std::atomic<std::uint64_t>> counters{};
+    run_threads(threads, [] {
+      for (int i = 0; i < increments; ++i)
+        counters[RequestKind::Get].fetch_add(1, std::memory_order_relaxed);
+    });
+    return counters[RequestKind::Get].load();
+  };
+
+  BENCHMARK("counter_array with 4 shards")
+  {
+    static enchantum::counter_array<RequestKind, shards> counters;
+    run_threads(threads, [] {
+      for (int i = 0; i < increments; ++i)
+        counters.increment(RequestKind::Get);
+    });
+    return counters.load(RequestKind::Get);
+  };
+
+  BENCHMARK("counter_array with the default shards")
+  {
+    static enchantum::counter_array<RequestKind> counters;
+    run_threads(threads, [] {
+      for (int i = 0; i < increments; ++i)
+        counters.increment(RequestKind::Get);
+    });
+    return counters.load(RequestKind::Get);
+  };
+}
@@ -0,0 +1,49 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <enchantum/enchantum.hpp>
+#include <enchantum/find_all.hpp>
+#include <string>
+#include <string_view>
+#include <utility>
+
+enum class ErrorCode {
+  ConnectionReset, ConnectionRefused, Timeout, DeadlineExceeded, NotFound, PermissionDenied, ResourceExhausted,
+  Unavailable, DataLoss, Unauthenticated, Cancelled, Aborted,
+};
+
+TEST_CASE("find every name in a log", "[benchmark][find_all]")
+{
+  std::string log;
+  for (std::size_t line = 0; log.size() < 64 * 1024; ++line) {
+    log += "2024-05-01T12:00:00Z worker=" + std::to_string(line % 97) + " request failed: ";
+    const auto name = enchantum::names<ErrorCode>[line % enchantum::count<ErrorCode>];
+    log.append(name.data(), name.size());
+    log += " while waiting for upstream\n";
+  }
+  const auto text = std::string_view(log);
+
+  const auto [min_size, max_size] = [] {
+    std::size_t min = static_cast<std::size_t>(-1);
+    std::size_t max = 0;
+    for (const auto name : enchantum::names<ErrorCode>) {
+      min = name.size() < min ? name.size() : min;
+      max = name.size() > max ? name.size() : max;
+    }
+    return std::pair(min, max);
+  }();
+
+  BENCHMARK("cast at every offset")
+  {
+    std::size_t found = 0;
+    for (std::size_t i = 0; i < text.size(); ++i)
+      for (auto size = min_size; size <= max_size && i + size <= text.size(); ++size)
+        found += enchantum::cast<ErrorCode>(text.substr(i, size)).has_value();
+    return found;
+  };
+
+  BENCHMARK("find_all")
+  {
+    return enchantum::find_all<ErrorCode>(text, [](std::size_t, ErrorCode) {});
+  };
+}
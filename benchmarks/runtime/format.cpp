@@ -0,0 +1,87 @@
+#define FMT_HEADER_ONLY
+#define FMT_UNICODE 0
+#include <fmt/format.h>
+
+#include <atomic>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdlib>
+#include <enchantum/bitwise_operators.hpp>
+#include <enchantum/fmt_format.hpp>
+#include <iterator>
+#include <new>
+#include <string>
+
+namespace {
+std::atomic<std::size_t> allocations{0};
+} // namespace
+
+// counts every heap allocation of the benchmarks, this is why this file is built as `allocation_benchmarks` on its own
+void* operator new(const std::size_t size)
+{
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* const p = std::malloc(size == 0 ? 1 : size))
+    return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* const p) noexcept { std::free(p); }
+void operator delete(void* const p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+// names longer than the small string buffer of std::string
+enum class Event {
+  ConnectionEstablished, RequestHeadersReceived, RequestBodyReceived, ResponseHeadersWritten, ResponseBodyWritten,
+  ConnectionClosedByPeer,
+};
+enum class Access : std::uint8_t { Read = 1 << 0, Write = 1 << 1, Execute = 1 << 2, Append = 1 << 3 };
+ENCHANTUM_DEFINE_BITWISE_FOR(Access)
+
+template<typename Func>
+std::size_t count_allocations(Func f)
+{
+  const auto before = allocations.load(std::memory_order_relaxed);
+  f();
+  return allocations.load(std::memory_order_relaxed) - before;
+}
+
+} // namespace
+
+TEST_CASE("fmt::formatter allocations", "[benchmark][format]")
+{
+  fmt::memory_buffer buffer;
+  buffer.reserve(4096);
+  const auto format_all = [&buffer] {
+    buffer.clear();
+    for (const auto event : enchantum::values<Event>)
+      fmt::format_to(std::back_inserter(buffer), "{} ", event);
+    fmt::format_to(std::back_inserter(buffer), "{} {:>24} {}", Access::Read | Access::Append,
+                   Event::ResponseBodyWritten, static_cast<Event>(42));
+  };
+
+  CHECK(count_allocations(format_all) == 0);
+  CHECK(count_allocations([] { (void)enchantum::details::format(Event::ConnectionClosedByPeer); }) == 1);
+  CHECK(fmt::to_string(buffer).find("Read|Append      ResponseBodyWritten 42") != std::string::npos);
+
+  // what the formatter did before: a string per formatted enum
+  BENCHMARK("std::string per enum")
+  {
+    buffer.clear();
+    for (const auto event : enchantum::values<Event>)
+      fmt::format_to(std::back_inserter(buffer), "{} ", enchantum::details::format(event));
+    fmt::format_to(std::back_inserter(buffer), "{} {}", enchantum::details::format(Access::Read | Access::Append),
+                   enchantum::details::format(static_cast<Event>(42)));
+    return buffer.size();
+  };
+
+  BENCHMARK("stack buffer")
+  {
+    buffer.clear();
+    for (const auto event : enchantum::values<Event>)
+      fmt::format_to(std::back_inserter(buffer), "{} ", event);
+    fmt::format_to(std::back_inserter(buffer), "{} {}", Access::Read | Access::Append, static_cast<Event>(42));
+    return buffer.size();
+  };
+}
@@ -0,0 +1,41 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <enchantum/enchantum.hpp>
+#include <enchantum/openmetrics.hpp>
+#include <string>
+
+enum class Status {
+  Ok, Created, Accepted, NoContent, MovedPermanently, Found, NotModified, BadRequest, Unauthorized, Forbidden,
+  NotFound, Conflict, Gone, TooManyRequests, InternalServerError, BadGateway, ServiceUnavailable, GatewayTimeout,
+};
+
+TEST_CASE("write_openmetrics", "[benchmark][openmetrics]")
+{
+  enchantum::array<Status, std::uint64_t> values{};
+  for (std::size_t i = 0; i < values.size(); ++i)
+    values[i] = i * 7919 + 13;
+
+  // what a scrape did before: build every label from `to_string` into a string
+  BENCHMARK("to_string and std::string")
+  {
+    std::string out;
+    for (const auto& [status, name] : enchantum::entries<Status>) {
+      out += "http_responses_total{status=\"";
+      out += std::string(name.data(), name.size());
+      out += "\"} ";
+      out += std::to_string(values[status]);
+      out += '\n';
+    }
+    return out.size();
+  };
+
+  BENCHMARK("write_openmetrics")
+  {
+    char       buffer[2048];
+    const auto result = enchantum::write_openmetrics(buffer, buffer + sizeof(buffer), "http_responses_total",
+                                                     "status", values, enchantum::metric_type::counter);
+    return result.ptr - buffer;
+  };
+}
@@ -0,0 +1,73 @@
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <enchantum/enchantum.hpp>
+#include <vector>
+
+#define SPARSE_ENUMERATORS                                                                                            \
+  V0 = -200, V1 = -190, V2 = -150, V3 = -149, V4 = -120, V5 = -90, V6 = -64, V7 = -40, V8 = -33, V9 = -20, V10 = -7,  \
+  V11 = 0, V12 = 3, V13 = 9, V14 = 17, V15 = 31, V16 = 32, V17 = 50, V18 = 77, V19 = 100, V20 = 101, V21 = 128,       \
+  V22 = 150, V23 = 170, V24 = 199, V25 = 200, V26 = 222, V27 = 240, V28 = 250, V29 = 255
+
+enum class Sparse : short { SPARSE_ENUMERATORS };
+enum class SparseSwitch : short { SPARSE_ENUMERATORS };
+
+template<>
+inline constexpr enchantum::to_string_lookup_mode enchantum::to_string_lookup<SparseSwitch> =
+  enchantum::to_string_lookup_mode::switch_case;
+
+static_assert(enchantum::index_layout<Sparse> == enchantum::index_layout_mode::rank_bitmap);
+
+namespace {
+
+// what `to_string` did for sparse enums before the bitmap and switch paths
+template<typename E>
+enchantum::string_view linear_to_string(const E value)
+{
+  for (std::size_t i = 0; i < enchantum::count<E>; ++i)
+    if (enchantum::values_generator<E>[i] == value)
+      return enchantum::names_generator<E>[i];
+  return enchantum::string_view();
+}
+
+template<typename E>
+std::vector<E> make_inputs()
+{
+  std::vector<E> inputs;
+  for (int round = 0; round < 64; ++round)
+    for (std::size_t i = 0; i < enchantum::count<E>; ++i)
+      inputs.push_back(enchantum::values<E>[(i * 7 + static_cast<std::size_t>(round)) % enchantum::count<E>]);
+  return inputs;
+}
+
+} // namespace
+
+TEST_CASE("to_string on a sparse enum", "[benchmark][to_string]")
+{
+  const auto inputs        = make_inputs<Sparse>();
+  const auto switch_inputs = make_inputs<SparseSwitch>();
+
+  BENCHMARK("linear")
+  {
+    std::size_t size = 0;
+    for (const auto e : inputs)
+      size += linear_to_string(e).size();
+    return size;
+  };
+
+  BENCHMARK("rank bitmap")
+  {
+    std::size_t size = 0;
+    for (const auto e : inputs)
+      size += enchantum::to_string(e).size();
+    return size;
+  };
+
+  BENCHMARK("switch")
+  {
+    std::size_t size = 0;
+    for (const auto e : switch_inputs)
+      size += enchantum::to_string(e).size();
+    return size;
+  };
+}
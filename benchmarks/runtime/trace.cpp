@@ -0,0 +1,48 @@
+#define FMT_HEADER_ONLY
+#define FMT_UNICODE 0
+#include <fmt/format.h>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <enchantum/fmt_format.hpp>
+#include <enchantum/trace.hpp>
+#include <iterator>
+
+enum class OrderEvent { Received, Validated, Routed, Acknowledged, PartiallyFilled, Filled, Cancelled, Rejected };
+enum class Venue { Primary, Dark, Auction };
+
+using Schema = enchantum::trace_schema<OrderEvent, Venue>;
+
+TEST_CASE("trace an event per call", "[benchmark][trace]")
+{
+  // formatting at the call site into a buffer which is reused
+  BENCHMARK("fmt::format_to")
+  {
+    fmt::memory_buffer buffer;
+    for (const auto e : enchantum::values<OrderEvent>)
+      fmt::format_to(std::back_inserter(buffer), "{} {}\n", e, Venue::Dark);
+    return buffer.size();
+  };
+
+  static enchantum::trace_ring<Schema, 1024> ring;
+  BENCHMARK("trace_ring::push")
+  {
+    for (const auto e : enchantum::values<OrderEvent>) {
+      ring.push(e);
+      ring.push(Venue::Dark);
+    }
+    return ring.consume([](auto) {});
+  };
+
+  BENCHMARK("trace_ring::push and decode")
+  {
+    for (const auto e : enchantum::values<OrderEvent>) {
+      ring.push(e);
+      ring.push(Venue::Dark);
+    }
+    std::size_t size = 0;
+    ring.consume_names([&size](auto, const auto name) { size += name.size(); });
+    return size;
+  };
+}
@@ -8,12 +8,22 @@
 #include "generators.hpp"
 #include "algorithms.hpp"
 #include "array.hpp"
+#include "atomic_bitset.hpp"
 #include "bitset.hpp"
 #include "bitflags.hpp"
 #include "bitwise_operators.hpp"
+#include "bulk.hpp"
+#include "charconv.hpp"
+#include "counter_array.hpp"
+#include "histogram_array.hpp"
+#include "openmetrics.hpp"
+#include "trace.hpp"
+#include "validate.hpp"
 #include "enchantum.hpp"
 #include "entries.hpp"
 #include "iostream.hpp"
+#include "find_all.hpp"
+#include "name_matcher.hpp"
 #include "next_value.hpp"
 #include "bitset.hpp"
 
@@ -0,0 +1,155 @@
+#pragma once
+#include "bitset.hpp"
+#include "details/word_bitset.hpp"
+#include "enchantum.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace enchantum {
+
+// lock free set of members of `E` made of `std::atomic<std::uint64_t>` words.
+// Operations on a single member are atomic, operations on a whole set are atomic per word.
+template<typename E>
+class atomic_bitset {
+  static_assert(std::is_enum_v<E>);
+public:
+  using bitset_type = bitset<E, details::word_bitset<count<E>>>;
+
+  static constexpr std::size_t word_count          = bitset_type::container_type::word_count;
+  static constexpr bool        is_always_lock_free = std::atomic<std::uint64_t>::is_always_lock_free;
+
+private:
+  std::atomic<std::uint64_t> m_words[word_count]{};
+
+  static constexpr std::size_t index_of(const E value)
+  {
+    if (const auto i = enchantum::enum_to_index(value))
+      return *i;
+    ENCHANTUM_THROW(std::out_of_range("enchantum::atomic_bitset out of range exception"), value);
+  }
+
+  static constexpr std::uint64_t mask_of(const std::size_t index) noexcept { return std::uint64_t{1} << (index % 64); }
+
+public:
+  atomic_bitset() noexcept = default;
+
+  explicit atomic_bitset(const bitset_type& values) noexcept
+  {
+    for (std::size_t i = 0; i < word_count; ++i)
+      m_words[i].store(values.word(i), std::memory_order_relaxed);
+  }
+
+  atomic_bitset(const std::initializer_list<E> values) : atomic_bitset(bitset_type(values)) {}
+
+  atomic_bitset(const atomic_bitset&)            = delete;
+  atomic_bitset& operator=(const atomic_bitset&) = delete;
+
+  [[nodiscard]] bool test(const E value, const std::memory_order order = std::memory_order_seq_cst) const
+  {
+    const auto i = index_of(value);
+    return (m_words[i / 64].load(order) & mask_of(i)) != 0;
+  }
+
+  // these give whether `value` was in the set before
+  bool set(const E value, const std::memory_order order = std::memory_order_seq_cst)
+  {
+    const auto i = index_of(value);
+    return (m_words[i / 64].fetch_or(mask_of(i), order) & mask_of(i)) != 0;
+  }
+
+  bool reset(const E value, const std::memory_order order = std::memory_order_seq_cst)
+  {
+    const auto i = index_of(value);
+    return (m_words[i / 64].fetch_and(~mask_of(i), order) & mask_of(i)) != 0;
+  }
+
+  bool flip(const E value, const std::memory_order order = std::memory_order_seq_cst)
+  {
+    const auto i = index_of(value);
+    return (m_words[i / 64].fetch_xor(mask_of(i), order) & mask_of(i)) != 0;
+  }
+
+  [[nodiscard]] bitset_type load(const std::memory_order order = std::memory_order_seq_cst) const noexcept
+  {
+    bitset_type ret;
+    for (std::size_t i = 0; i < word_count; ++i)
+      ret.set_word(i, m_words[i].load(order));
+    return ret;
+  }
+
+  void store(const bitset_type& values, const std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    for (std::size_t i = 0; i < word_count; ++i)
+      m_words[i].store(values.word(i), order);
+  }
+
+  // these give the set before the operation
+  bitset_type fetch_or(const bitset_type& values, const std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    bitset_type ret;
+    for (std::size_t i = 0; i < word_count; ++i)
+      ret.set_word(i, m_words[i].fetch_or(values.word(i), order));
+    return ret;
+  }
+
+  bitset_type fetch_and(const bitset_type& values, const std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    bitset_type ret;
+    for (std::size_t i = 0; i < word_count; ++i)
+      ret.set_word(i, m_words[i].fetch_and(values.word(i), order));
+    return ret;
+  }
+
+  // replaces the whole set with `desired` if it equals `expected`, otherwise loads it into `expected`.
+  // Only for enums of at most 64 members since it has to be a single word
+  bool compare_exchange_weak(bitset_type&            expected,
+                             const bitset_type&      desired,
+                             const std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    static_assert(word_count == 1, "enchantum::atomic_bitset::compare_exchange_weak requires at most 64 members");
+    auto       word = expected.word(0);
+    const bool ret  = m_words[0].compare_exchange_weak(word, desired.word(0), order);
+    expected.set_word(0, word);
+    return ret;
+  }
+
+  bool compare_exchange_strong(bitset_type&            expected,
+                               const bitset_type&      desired,
+                               const std::memory_order order = std::memory_order_seq_cst) noexcept
+  {
+    static_assert(word_count == 1, "enchantum::atomic_bitset::compare_exchange_strong requires at most 64 members");
+    auto       word = expected.word(0);
+    const bool ret  = m_words[0].compare_exchange_strong(word, desired.word(0), order);
+    expected.set_word(0, word);
+    return ret;
+  }
+
+#if defined(__cpp_lib_atomic_wait)
+  // blocks until `test(value) != old`, `order` can not be `memory_order_release` or `memory_order_acq_rel` like
+  // `std::atomic::wait`
+  void wait(const E value, const bool old, const std::memory_order order = std::memory_order_seq_cst) const
+  {
+    ENCHANTUM_ASSERT(order != std::memory_order_release && order != std::memory_order_acq_rel,
+                     "enchantum::atomic_bitset::wait requires a load memory order",
+                     order);
+    const auto i    = index_of(value);
+    auto&      word = m_words[i / 64];
+    for (auto w = word.load(order); ((w & mask_of(i)) != 0) == old; w = word.load(order))
+      word.wait(w, order);
+  }
+
+  // wakes every thread waiting on `value`, members sharing its word are woken too and wait again
+  void notify_all(const E value) { m_words[index_of(value) / 64].notify_all(); }
+
+  void notify_all() noexcept
+  {
+    for (auto& word : m_words)
+      word.notify_all();
+  }
+#endif
+};
+
+} // namespace enchantum
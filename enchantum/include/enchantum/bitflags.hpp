@@ -1,9 +1,18 @@
 #pragma once
 #include "common.hpp"
+#include "details/bit_extract.hpp"
+#include "details/countr_zero.hpp"
+#include "details/popcount.hpp"
 #include "details/string.hpp"
 #include "details/string_view.hpp"
 #include "enchantum.hpp"
 #include "generators.hpp"
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
 
 #if defined(ENCAHNTUM_DETAILS_GCC_MAJOR) && ENCAHNTUM_DETAILS_GCC_MAJOR <= 10
   #pragma GCC diagnostic push
@@ -11,6 +20,9 @@
   #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 #endif
 
+#ifndef ENCHANTUM_BITFLAG_VIEW_MAX_FLAGS
+  #define ENCHANTUM_BITFLAG_VIEW_MAX_FLAGS 8
+#endif
 
 namespace enchantum {
 
@@ -25,6 +37,195 @@ inline constexpr E value_ors = [] {
 }();
 
 
+// whether the string overloads of `cast_bitflag` and `contains_bitflag` accept spaces and tabs around separators
+enum class bitflag_spaces : unsigned char {
+  reject, // "A|B" only
+  trim,   // "A | B" is the same as "A|B"
+};
+
+namespace details {
+  // every non zero flag is a single bit and none is negative so the flags sorted by value are sorted by bit
+  template<typename E>
+  inline constexpr bool has_single_bit_flags = [] {
+    using T = std::underlying_type_t<E>;
+    if constexpr (std::is_same_v<T, bool>) {
+      return false;
+    }
+    else {
+      for (const auto v : values_generator<E>) {
+        const auto u = static_cast<std::make_unsigned_t<T>>(v);
+        if (details::cmp_less(static_cast<T>(v), 0) || (u & (u - 1)) != 0)
+          return false;
+      }
+      return true;
+    }
+  }();
+
+  // calls `f(i)` with the index of each flag set in `value` in ascending order,
+  // gives false if `value` has bits which are not flags. The zero flag is never passed.
+  template<typename E, typename Func>
+  constexpr bool for_each_flag_index(const std::underlying_type_t<E> value, Func f)
+  {
+    using T = std::underlying_type_t<E>;
+    if constexpr (has_single_bit_flags<E>) {
+      using U              = std::make_unsigned_t<T>;
+      constexpr auto flags = static_cast<U>(value_ors<E>);
+      auto           bits  = static_cast<U>(value);
+      if ((bits & static_cast<U>(~flags)) != 0)
+        return false;
+
+      // only visits the set bits
+      for (; bits != 0; bits = static_cast<U>(bits & (bits - 1))) {
+        if constexpr (is_contiguous_bitflag<E>) {
+          constexpr auto first = details::countr_zero(static_cast<U>(values_generator<E>[has_zero_flag<E>]));
+          f(std::size_t{has_zero_flag<E>} + static_cast<std::size_t>(details::countr_zero(bits) - first));
+        }
+        else {
+          // the rank of the bit among the flags
+          const auto lowest = static_cast<U>(bits & static_cast<U>(~bits + 1));
+          f(std::size_t{has_zero_flag<E>} + static_cast<std::size_t>(details::popcount(static_cast<U>(flags & (lowest - 1)))));
+        }
+      }
+      return true;
+    }
+    else {
+      T check_value = 0;
+      for (auto i = std::size_t{has_zero_flag<E>}; i < count<E>; ++i) {
+        const auto v = static_cast<T>(values_generator<E>[i]);
+        if (v == (value & v)) {
+          f(i);
+          check_value |= v;
+        }
+      }
+      return check_value == value;
+    }
+  }
+
+  // number of flags excluding the zero flag
+  template<typename E>
+  inline constexpr std::size_t flag_count = count<E> - std::size_t{has_zero_flag<E>};
+
+  // bit `i` of the result is set if the `i`th non zero flag is set in `bits`, bits which are not flags are dropped
+  template<typename E>
+  constexpr auto flag_ranks(const std::make_unsigned_t<std::underlying_type_t<E>> bits) noexcept
+  {
+    static_assert(has_single_bit_flags<E>, "");
+    using T = std::underlying_type_t<E>;
+    using U = std::make_unsigned_t<T>;
+    if constexpr (is_contiguous_bitflag<E>) {
+      constexpr auto first = details::countr_zero(static_cast<U>(values_generator<E>[has_zero_flag<E>]));
+      return static_cast<U>(static_cast<U>(bits & static_cast<U>(value_ors<E>)) >> first);
+    }
+    else {
+      return static_cast<U>(details::bit_extract(bits, static_cast<U>(value_ors<E>)));
+    }
+  }
+
+  // the inverse of `flag_ranks`
+  template<typename E>
+  constexpr auto flag_bits(const std::make_unsigned_t<std::underlying_type_t<E>> ranks) noexcept
+  {
+    static_assert(has_single_bit_flags<E>, "");
+    using U = std::make_unsigned_t<std::underlying_type_t<E>>;
+    if constexpr (is_contiguous_bitflag<E>) {
+      constexpr auto first = details::countr_zero(static_cast<U>(values_generator<E>[has_zero_flag<E>]));
+      return static_cast<U>(ranks << first);
+    }
+    else {
+      return static_cast<U>(details::bit_deposit(ranks, static_cast<U>(value_ors<E>)));
+    }
+  }
+
+  template<std::size_t Combinations, std::size_t Chars>
+  struct FlagStrings {
+    // combination `i` is [offsets[i], offsets[i + 1]) of `chars`
+    std::array<std::uint32_t, Combinations + 1> offsets{};
+    std::array<char, Chars == 0 ? 1 : Chars>    chars{};
+
+    constexpr string_view operator[](const std::size_t i) const noexcept
+    {
+      return string_view(chars.data() + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+  };
+
+  // writes combination `n` of group `g` where `combination` is `g << Width | n`, the flags are the ones with a rank of
+  // `g * Width + i` for every bit `i` set in `n`. Only counts the characters if `out` is null
+  template<typename E, char Sep, std::size_t Width>
+  constexpr std::size_t render_flag_combination(const std::size_t combination, char* const out) noexcept
+  {
+    const auto  first = std::size_t{has_zero_flag<E>} + (combination >> Width) * Width;
+    std::size_t size  = 0;
+    for (std::size_t bit = 0; bit < Width; ++bit) {
+      if (((combination >> bit) & 1) == 0 || first + bit >= count<E>)
+        continue;
+      if (size != 0) {
+        if (out)
+          out[size] = Sep;
+        ++size;
+      }
+      const auto s = names_generator<E>[first + bit];
+      if (out)
+        for (std::size_t c = 0; c < s.size(); ++c)
+          out[size + c] = s.data()[c];
+      size += s.size();
+    }
+    return size;
+  }
+
+  template<typename E, char Sep, std::size_t Width>
+  constexpr auto make_flag_strings() noexcept
+  {
+    constexpr std::size_t combinations = ((flag_count<E> + Width - 1) / Width) << Width;
+    constexpr std::size_t chars        = [] {
+      std::size_t ret = 0;
+      for (std::size_t i = 0; i < combinations; ++i)
+        ret += details::render_flag_combination<E, Sep, Width>(i, nullptr);
+      return ret;
+    }();
+
+    FlagStrings<combinations, chars> ret{};
+    std::size_t                      offset = 0;
+    for (std::size_t i = 0; i < combinations; ++i) {
+      ret.offsets[i] = static_cast<std::uint32_t>(offset);
+      offset += details::render_flag_combination<E, Sep, Width>(i, ret.chars.data() + offset);
+    }
+    ret.offsets[combinations] = static_cast<std::uint32_t>(offset);
+    return ret;
+  }
+
+  // every combination of `Width` flags at a time joined by `Sep`, see `render_flag_combination`
+  template<typename E, char Sep, std::size_t Width>
+  inline constexpr auto flag_strings = details::make_flag_strings<E, Sep, Width>();
+
+  // calls `f(token)` for every part of `s` between separators in a single pass, spaces and tabs around a token are
+  // skipped with `bitflag_spaces::trim`. Stops and gives false at the first token `f` rejects
+  template<typename Func>
+  constexpr bool for_each_flag_token(const string_view s, const char sep, const bitflag_spaces spaces, Func f)
+  {
+    const auto  is_space = [spaces](const char c) { return spaces == bitflag_spaces::trim && (c == ' ' || c == '\t'); };
+    const char* first    = s.data();
+    const char* end      = s.data() + s.size();
+    while (true) {
+      // memchr outside of constant evaluation
+      const char* found = std::char_traits<char>::find(first, static_cast<std::size_t>(end - first), sep);
+      const char* last  = found ? found : end;
+      while (first != last && is_space(*first))
+        ++first;
+      while (last != first && is_space(last[-1]))
+        --last;
+      if (!f(string_view(first, static_cast<std::size_t>(last - first))))
+        return false;
+      if (!found)
+        return true;
+      first = found + 1;
+    }
+  }
+
+  template<typename E>
+  inline constexpr bool has_flag_view = has_single_bit_flags<E> && flag_count<E> != 0 &&
+    flag_count<E> <= ENCHANTUM_BITFLAG_VIEW_MAX_FLAGS;
+} // namespace details
+
 template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
 [[nodiscard]] constexpr bool contains_bitflag(const std::underlying_type_t<E> value) noexcept
 {
@@ -42,30 +243,46 @@ template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
 }
 
 template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename BinaryPred>
-[[nodiscard]] constexpr bool contains_bitflag(const string_view s, const char sep, const BinaryPred binary_pred) noexcept
+[[nodiscard]] constexpr bool contains_bitflag(const string_view    s,
+                                              const char           sep,
+                                              const BinaryPred     binary_pred,
+                                              const bitflag_spaces spaces = bitflag_spaces::reject) noexcept
 {
-  std::size_t pos = 0;
-  for (std::size_t i = s.find(sep); i != s.npos; i = s.find(sep, pos)) {
-    if (!enchantum::contains<E>(s.substr(pos, i - pos), binary_pred))
-      return false;
-    pos = i + 1;
-  }
-  return enchantum::contains<E>(s.substr(pos), binary_pred);
+  return details::for_each_flag_token(s, sep, spaces, [binary_pred](const string_view token) {
+    return enchantum::contains<E>(token, binary_pred);
+  });
 }
 
 
 template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
-[[nodiscard]] constexpr bool contains_bitflag(const string_view s, const char sep = '|') noexcept
+[[nodiscard]] constexpr bool contains_bitflag(const string_view    s,
+                                              const char           sep    = '|',
+                                              const bitflag_spaces spaces = bitflag_spaces::reject) noexcept
 {
-  std::size_t pos = 0;
-  for (std::size_t i = s.find(sep); i != s.npos; i = s.find(sep, pos)) {
-    if (!enchantum::contains<E>(s.substr(pos, i - pos)))
-      return false;
-    pos = i + 1;
-  }
-  return enchantum::contains<E>(s.substr(pos));
+  return details::for_each_flag_token(s, sep, spaces, [](const string_view token) {
+    return details::name_to_index<E>(token) != count<E>;
+  });
 }
 
+// gives the same string as `to_string_bitflag(value, Sep)` without allocating, every combination of flags is rendered
+// at compile time into a single pool. Only for enums of at most ENCHANTUM_BITFLAG_VIEW_MAX_FLAGS single bit flags
+template<char Sep = '|', ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
+[[nodiscard]] constexpr string_view to_string_bitflag_view(const E value) noexcept
+{
+  static_assert(details::has_flag_view<E>,
+                "enchantum::to_string_bitflag_view requires at most ENCHANTUM_BITFLAG_VIEW_MAX_FLAGS single bit flags");
+  using T = std::underlying_type_t<E>;
+  using U = std::make_unsigned_t<T>;
+  if constexpr (has_zero_flag<E>)
+    if (static_cast<T>(value) == 0)
+      return names_generator<E>[0];
+
+  constexpr auto flags = static_cast<U>(value_ors<E>);
+  const auto     bits  = static_cast<U>(value);
+  if ((bits & static_cast<U>(~flags)) != 0)
+    return string_view();
+  return details::flag_strings<E, Sep, details::flag_count<E>>[details::flag_ranks<E>(bits)];
+}
 
 template<typename String = string, ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
 [[nodiscard]] constexpr String to_string_bitflag(const E value, const char sep = '|')
@@ -75,46 +292,148 @@ template<typename String = string, ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
     if (static_cast<T>(value) == 0)
       return String(names_generator<E>[0]);
 
-  String name;
-  T      check_value = 0;
+  if constexpr (details::has_flag_view<E>)
+    if (sep == '|')
+      return String(enchantum::to_string_bitflag_view(value));
+
+  String     name;
+  const bool valid = details::for_each_flag_index<E>(static_cast<T>(value), [&name, sep](const std::size_t i) {
+    const auto s = names_generator<E>[i];
+    if (!name.empty())
+      name.append(1, sep);           // append separator if not the first value
+    name.append(s.data(), s.size()); // not using operator += since this may not be std::string_view always
+  });
+  if (valid)
+    return name;
+  return String();
+}
+
+// longest string `to_string_bitflag` can give for `E`, the separator is a single character whichever it is
+template<typename E>
+inline constexpr std::size_t max_bitflag_string_length = [] {
+  static_assert(is_bitflag<E>, "");
+  std::size_t flags = 0;
+  std::size_t ret   = 0;
   for (auto i = std::size_t{has_zero_flag<E>}; i < count<E>; ++i) {
-    const auto v = static_cast<T>(values_generator<E>[i]);
-    if (v == (static_cast<T>(value) & v)) {
-      const auto s = names_generator<E>[i];
-      if (!name.empty())
-        name.append(1, sep);           // append separator if not the first value
-      name.append(s.data(), s.size()); // not using operator += since this may not be std::string_view always
-      check_value |= v;
+    ret += names_generator<E>[i].size();
+    ++flags;
+  }
+  ret += flags == 0 ? 0 : flags - 1;
+  if constexpr (has_zero_flag<E>)
+    ret = details::Max(ret, names_generator<E>[0].size());
+  return ret;
+}();
+
+// writes the same string as `to_string_bitflag(value, sep)` into [first, last) without allocating.
+// gives {end of the string, errc{}}, {last, errc::value_too_large} if it does not fit
+// or {first, errc::invalid_argument} if `value` has bits which are not flags of `E`
+template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
+[[nodiscard]] constexpr std::to_chars_result to_string_bitflag(char* first,
+                                                               char* const last,
+                                                               const E     value,
+                                                               const char  sep = '|') noexcept
+{
+  using T           = std::underlying_type_t<E>;
+  const auto start  = first;
+  const auto append = [&first, last](const string_view s) {
+    const auto size = s.size();
+    if (static_cast<std::size_t>(last - first) < size)
+      return false;
+    for (std::size_t i = 0; i < size; ++i)
+      first[i] = s.data()[i];
+    first += size;
+    return true;
+  };
+
+  if constexpr (has_zero_flag<E>)
+    if (static_cast<T>(value) == 0)
+      return append(names_generator<E>[0]) ? std::to_chars_result{first, std::errc{}}
+                                           : std::to_chars_result{last, std::errc::value_too_large};
+
+  // the default separator copies whole combinations of flags from the tables built at compile time
+  if constexpr (details::has_flag_view<E>) {
+    if (sep == '|') {
+      const auto name = enchantum::to_string_bitflag_view(value);
+      if (name.size() == 0 && static_cast<T>(value) != 0)
+        return {start, std::errc::invalid_argument};
+      return append(name) ? std::to_chars_result{first, std::errc{}}
+                          : std::to_chars_result{last, std::errc::value_too_large};
     }
   }
-  if (check_value == static_cast<T>(value))
-    return name;
-  return String();
+  else if constexpr (details::has_single_bit_flags<E> && is_contiguous_bitflag<E>) {
+    if (sep == '|') {
+      using U              = std::make_unsigned_t<T>;
+      constexpr auto flags = static_cast<U>(value_ors<E>);
+      const auto     bits  = static_cast<U>(value);
+      if ((bits & static_cast<U>(~flags)) != 0)
+        return {start, std::errc::invalid_argument};
+
+      // 4 flags at a time
+      constexpr auto& chunks = details::flag_strings<E, '|', 4>;
+      auto            ranks  = details::flag_ranks<E>(bits);
+      for (std::size_t chunk = 0; ranks != 0; ranks = static_cast<U>(ranks >> 4), chunk += 16) {
+        if ((ranks & 15) == 0)
+          continue;
+        if (first != start) {
+          if (first == last)
+            return {last, std::errc::value_too_large};
+          *first++ = '|';
+        }
+        if (!append(chunks[chunk | static_cast<std::size_t>(ranks & 15)]))
+          return {last, std::errc::value_too_large};
+      }
+      return {first, std::errc{}};
+    }
+  }
+
+  bool fits = true;
+  const bool valid = details::for_each_flag_index<E>(static_cast<T>(value), [&](const std::size_t i) {
+    if (fits && first != start) {
+      fits = first != last;
+      if (fits)
+        *first++ = sep;
+    }
+    fits = fits && append(names_generator<E>[i]);
+  });
+  if (!fits)
+    return {last, std::errc::value_too_large};
+  if (!valid)
+    return {start, std::errc::invalid_argument};
+  return {first, std::errc{}};
 }
 
 template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename BinaryPred>
-[[nodiscard]] constexpr optional<E> cast_bitflag(const string_view s, const char sep, const BinaryPred binary_pred) noexcept
+[[nodiscard]] constexpr optional<E> cast_bitflag(const string_view    s,
+                                                 const char           sep,
+                                                 const BinaryPred     binary_pred,
+                                                 const bitflag_spaces spaces = bitflag_spaces::reject) noexcept
 {
   using T = std::underlying_type_t<E>;
-  T           check_value{};
-  std::size_t pos = 0;
-  for (std::size_t i = s.find(sep); i != s.npos; i = s.find(sep, pos)) {
-    if (const auto v = enchantum::cast<E>(s.substr(pos, i - pos), binary_pred))
+  T          check_value{};
+  const bool valid = details::for_each_flag_token(s, sep, spaces, [&check_value, binary_pred](const string_view token) {
+    const auto v = enchantum::cast<E>(token, binary_pred);
+    if (v)
       check_value |= static_cast<T>(*v);
-    else
-      return optional<E>();
-    pos = i + 1;
-  }
-
-  if (const auto v = enchantum::cast<E>(s.substr(pos), binary_pred))
-    return optional<E>(static_cast<E>(check_value | static_cast<T>(*v)));
-  return optional<E>();
+    return bool(v);
+  });
+  return valid ? optional<E>(static_cast<E>(check_value)) : optional<E>();
 }
 
 template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
-[[nodiscard]] constexpr optional<E> cast_bitflag(const string_view s, const char sep = '|') noexcept
+[[nodiscard]] constexpr optional<E> cast_bitflag(const string_view    s,
+                                                 const char           sep    = '|',
+                                                 const bitflag_spaces spaces = bitflag_spaces::reject) noexcept
 {
-  return enchantum::cast_bitflag<E>(s, sep, [](const auto& a, const auto& b) { return a == b; });
+  using T = std::underlying_type_t<E>;
+  T          check_value{};
+  const bool valid = details::for_each_flag_token(s, sep, spaces, [&check_value](const string_view token) {
+    const auto i = details::name_to_index<E>(token);
+    if (i == count<E>)
+      return false;
+    check_value |= static_cast<T>(values_generator<E>[i]);
+    return true;
+  });
+  return valid ? optional<E>(static_cast<E>(check_value)) : optional<E>();
 }
 
 template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
@@ -1,17 +1,19 @@
 #pragma once
 #include "enchantum.hpp"
-#ifndef ENCHANTUM_ALIAS_BITSET
-  #include <bitset>
-#endif
 #include "bitflags.hpp"
+#include "details/word_bitset.hpp"
 #include "generators.hpp"
+#include <cstddef>
+#include <cstdint>
 #include <stdexcept>
+#include <type_traits>
 
 namespace enchantum {
 
 namespace details {
 #ifndef ENCHANTUM_ALIAS_BITSET
-  using ::std::bitset;
+  template<std::size_t N>
+  using bitset = word_bitset<N>;
 #else
   ENCHANTUM_ALIAS_BITSET;
 #endif
@@ -34,17 +36,87 @@ public:
   using Container::Container;
   using Container::operator=;
 
+  // calls `f(i)` for the index of every set bit in ascending order
+  template<typename Func>
+  constexpr void for_each_index(Func f) const
+  {
+    if constexpr (details::is_word_bitset<Container>) {
+      // only visits the set bits
+      for (auto i = Container::find_first(); i != enchantum::count<E>; i = Container::find_next(i))
+        f(i);
+    }
+    else {
+      for (std::size_t i = 0; i < enchantum::count<E>; ++i)
+        if (Container::operator[](i))
+          f(i);
+    }
+  }
+
+  // calls `f(value)` for every member of `E` in the set in ascending order
+  template<typename Func>
+  constexpr void for_each(Func f) const
+  {
+    for_each_index([&f](const std::size_t i) { f(enchantum::values_generator<E>[i]); });
+  }
+
+  // the set of flags in `value`, bits which are not flags are dropped and the zero flag is never set
+  [[nodiscard]] static constexpr bitset from_flags(const E value) noexcept
+  {
+    static_assert(details::has_single_bit_flags<E>, "enchantum::bitset::from_flags requires single bit flags");
+    using U          = std::make_unsigned_t<std::underlying_type_t<E>>;
+    const auto ranks = static_cast<std::uint64_t>(details::flag_ranks<E>(static_cast<U>(value)));
+
+    if constexpr (enchantum::count<E> <= 64) {
+      return bitset(static_cast<unsigned long long>(ranks << has_zero_flag<E>));
+    }
+    else if constexpr (details::is_word_bitset<Container>) {
+      // 64 flags and the zero flag
+      bitset ret;
+      ret.set_word(0, ranks << 1);
+      ret.set_word(1, ranks >> 63);
+      return ret;
+    }
+    else {
+      bitset ret;
+      for (auto r = ranks; r != 0; r &= r - 1)
+        ret.Container::set(std::size_t{has_zero_flag<E>} + static_cast<std::size_t>(details::countr_zero(r)));
+      return ret;
+    }
+  }
+
+  // the bitwise or of every flag in the set
+  [[nodiscard]] constexpr E to_flags() const noexcept
+  {
+    static_assert(details::has_single_bit_flags<E>, "enchantum::bitset::to_flags requires single bit flags");
+    using U             = std::make_unsigned_t<std::underlying_type_t<E>>;
+    std::uint64_t ranks = 0;
+
+    if constexpr (details::is_word_bitset<Container>) {
+      ranks = Container::word(0) >> has_zero_flag<E>;
+      if constexpr (Container::word_count > 1)
+        ranks |= Container::word(1) << 63;
+    }
+    else if constexpr (enchantum::count<E> <= 64) {
+      ranks = static_cast<std::uint64_t>(Container::to_ullong()) >> has_zero_flag<E>;
+    }
+    else {
+      for_each_index([&ranks](const std::size_t i) {
+        if (i >= std::size_t{has_zero_flag<E>})
+          ranks |= std::uint64_t{1} << (i - has_zero_flag<E>);
+      });
+    }
+    return static_cast<E>(details::flag_bits<E>(static_cast<U>(ranks)));
+  }
+
   [[nodiscard]] string to_string(const char sep = '|') const
   {
     string name;
-    for (std::size_t i = 0; i < enchantum::count<E>; ++i) {
-      if (test(i)) {
-        const auto s = enchantum::names_generator<E>[i];
-        if (!name.empty())
-          name += sep;
-        name.append(s.data(), s.size()); // not using operator += since this may not be std::string_view always
-      }
-    }
+    for_each_index([&name, sep](const std::size_t i) {
+      const auto s = enchantum::names_generator<E>[i];
+      if (!name.empty())
+        name += sep;
+      name.append(s.data(), s.size()); // not using operator += since this may not be std::string_view always
+    });
     return name;
   }
 
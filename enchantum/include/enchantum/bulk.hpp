@@ -0,0 +1,121 @@
+#pragma once
+
+#include "common.hpp"
+#include "details/optional.hpp"
+#include "details/string_view.hpp"
+#include "enchantum.hpp"
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#if defined(ENCAHNTUM_DETAILS_GCC_MAJOR) && ENCAHNTUM_DETAILS_GCC_MAJOR <= 10
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wconversion"
+#endif
+
+// All functions take contiguous ranges, anything `std::data` and `std::size` accept such as `std::span`,
+// `std::vector` or a C array. The output range must be at least as large as the input range.
+namespace enchantum {
+namespace details {
+  template<typename Range>
+  using range_value_t = std::remove_cv_t<std::remove_reference_t<decltype(*std::data(std::declval<Range&>()))>>;
+
+  // contiguous enums index `names<E>` or test the range with unsigned arithmetic which compilers vectorize
+  template<typename E>
+  inline constexpr bool bulk_contiguous = is_contiguous<E> && !std::is_same_v<std::underlying_type_t<E>, bool>;
+
+  template<typename E>
+  inline constexpr bool bulk_contiguous_bitflag = is_contiguous_bitflag<E> &&
+    !std::is_same_v<std::underlying_type_t<E>, bool>;
+} // namespace details
+
+namespace bulk {
+
+  template<typename Input, typename Output>
+  constexpr void to_string(const Input& values, Output&& names) noexcept
+  {
+    using E = enchantum::details::range_value_t<const Input>;
+    static_assert(std::is_enum_v<E>, "enchantum::bulk::to_string requires a range of enums");
+
+    const auto size = static_cast<std::size_t>(std::size(values));
+    ENCHANTUM_ASSERT(static_cast<std::size_t>(std::size(names)) >= size,
+                     "enchantum::bulk::to_string output range is smaller than the input range",
+                     size);
+    const auto* const in  = std::data(values);
+    auto* const       out = std::data(names);
+
+    if constexpr (enchantum::details::bulk_contiguous<E>) {
+      using T               = std::underlying_type_t<E>;
+      using U               = std::make_unsigned_t<T>;
+      constexpr auto& table = enchantum::names<E>;
+      constexpr auto  first = static_cast<U>(static_cast<T>(min<E>));
+      for (std::size_t i = 0; i < size; ++i) {
+        const auto index = static_cast<std::size_t>(static_cast<U>(static_cast<U>(static_cast<T>(in[i])) - first));
+        out[i]           = index < count<E> ? table[index] : string_view();
+      }
+    }
+    else {
+      for (std::size_t i = 0; i < size; ++i)
+        out[i] = enchantum::to_string(in[i]);
+    }
+  }
+
+  template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E), typename Input, typename Output>
+  constexpr void cast(const Input& names, Output&& results) noexcept
+  {
+    const auto size = static_cast<std::size_t>(std::size(names));
+    ENCHANTUM_ASSERT(static_cast<std::size_t>(std::size(results)) >= size,
+                     "enchantum::bulk::cast output range is smaller than the input range",
+                     size);
+    const auto* const in  = std::data(names);
+    auto* const       out = std::data(results);
+
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto index = enchantum::details::name_to_index<E>(in[i]);
+      out[i]           = index != count<E> ? optional<E>(values<E>[index]) : optional<E>();
+    }
+  }
+
+  // `values` may hold `E` or its underlying type, `results` gets whether each of them is a member of `E`
+  template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E), typename Input, typename Output>
+  constexpr void contains(const Input& values, Output&& results) noexcept
+  {
+    using T = std::underlying_type_t<E>;
+
+    const auto size = static_cast<std::size_t>(std::size(values));
+    ENCHANTUM_ASSERT(static_cast<std::size_t>(std::size(results)) >= size,
+                     "enchantum::bulk::contains output range is smaller than the input range",
+                     size);
+    const auto* const in  = std::data(values);
+    auto* const       out = std::data(results);
+
+    if constexpr (enchantum::details::bulk_contiguous<E>) {
+      using U              = std::make_unsigned_t<T>;
+      constexpr auto first = static_cast<U>(static_cast<T>(min<E>));
+      constexpr auto span  = static_cast<U>(static_cast<U>(static_cast<T>(max<E>)) - first);
+      for (std::size_t i = 0; i < size; ++i)
+        out[i] = static_cast<U>(static_cast<U>(static_cast<T>(in[i])) - first) <= span;
+    }
+    else if constexpr (enchantum::details::bulk_contiguous_bitflag<E>) {
+      using U            = std::make_unsigned_t<T>;
+      constexpr auto lo  = static_cast<T>(min<E>);
+      constexpr auto hi  = static_cast<T>(max<E>);
+      for (std::size_t i = 0; i < size; ++i) {
+        const auto v = static_cast<T>(in[i]);
+        const auto u = static_cast<U>(v);
+        // `&` instead of `&&` keeps the loop free of branches
+        out[i] = (v >= lo) & (v <= hi) & (static_cast<U>(u & static_cast<U>(u - 1)) == 0) & ((u != 0) | has_zero_flag<E>);
+      }
+    }
+    else {
+      for (std::size_t i = 0; i < size; ++i)
+        out[i] = enchantum::contains<E>(static_cast<T>(in[i]));
+    }
+  }
+
+} // namespace bulk
+} // namespace enchantum
+
+#if defined(ENCAHNTUM_DETAILS_GCC_MAJOR) && ENCAHNTUM_DETAILS_GCC_MAJOR <= 10
+  #pragma GCC diagnostic pop
+#endif
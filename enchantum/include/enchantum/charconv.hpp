@@ -0,0 +1,104 @@
+#pragma once
+#include "bitflags.hpp"
+#include "details/string_view.hpp"
+#include "enchantum.hpp"
+#include <charconv>
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+
+namespace enchantum {
+
+// how `to_chars` and `from_chars` handle values which are not names
+enum class chars_fallback : unsigned char {
+  none,   // only names
+  number, // `to_chars` writes the underlying value of values without a name and `from_chars` accepts numbers
+};
+
+// writes the name of `value`, or its flags joined by `|` for bitflag enums, into [first, last) without allocating.
+// gives {end of the name, errc{}}, {last, errc::value_too_large} if it does not fit
+// or {first, errc::invalid_argument} if `value` has no name and `fallback` is `chars_fallback::none`
+template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
+[[nodiscard]] std::to_chars_result to_chars(char* const          first,
+                                            char* const          last,
+                                            const E              value,
+                                            const chars_fallback fallback = chars_fallback::none) noexcept
+{
+  if constexpr (is_bitflag<E>) {
+    // an empty string is 0 without a zero flag
+    const auto result = enchantum::to_string_bitflag(first, last, value);
+    if (result.ec == std::errc::value_too_large || (result.ec == std::errc{} && result.ptr != first))
+      return result;
+  }
+  else if (const auto i = enchantum::enum_to_index(value)) {
+    // straight from the reflected name storage
+    const auto* const indices = details::reflection_string_indices<E, true>.data();
+    const auto* const name    = details::reflection_data_string_storage<E, true>.data() + indices[*i];
+    const auto        size    = static_cast<std::size_t>(indices[*i + 1] - indices[*i] - 1);
+    if (static_cast<std::size_t>(last - first) < size)
+      return {last, std::errc::value_too_large};
+    for (std::size_t c = 0; c < size; ++c)
+      first[c] = name[c];
+    return {first + size, std::errc{}};
+  }
+
+  if (fallback == chars_fallback::none)
+    return {first, std::errc::invalid_argument};
+  // promote using + to select int overload if to underlying returns char
+  return std::to_chars(first, last, +enchantum::to_underlying(value));
+}
+
+// takes the longest run of `[A-Za-z0-9_]`, and `|` for bitflag enums, at the start of [first, last). If the whole run is
+// a name, or flags joined by `|`, it is read into `value` and gives {end of the run, errc{}} so it can be used to
+// tokenize, "RedX" is rejected rather than read as `Red`. Spaces end the run so flags are read without spaces around
+// `|` like `cast_bitflag` does by default. With `chars_fallback::number` a number of the underlying type is read if
+// there is no name. Otherwise gives {first, errc::invalid_argument} or {end of the number, errc::result_out_of_range}
+// and leaves `value` unchanged
+template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
+[[nodiscard]] std::from_chars_result from_chars(const char* const    first,
+                                                const char* const    last,
+                                                E&                   value,
+                                                const chars_fallback fallback = chars_fallback::none) noexcept
+{
+  const auto is_name_char = [](const char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' ||
+      (is_bitflag<E> && c == '|');
+  };
+  const char* end = first;
+  while (end != last && is_name_char(*end))
+    ++end;
+  if constexpr (is_bitflag<E>)
+    while (end != first && end[-1] == '|')
+      --end;
+
+  if (end != first) {
+    const auto name = string_view(first, static_cast<std::size_t>(end - first));
+    if constexpr (is_bitflag<E>) {
+      if (const auto v = enchantum::cast_bitflag<E>(name)) {
+        value = *v;
+        return {end, std::errc{}};
+      }
+    }
+    else if (const auto i = details::name_to_index<E>(name); i != count<E>) {
+      value = values_generator<E>[i];
+      return {end, std::errc{}};
+    }
+  }
+
+  if (fallback == chars_fallback::none)
+    return {first, std::errc::invalid_argument};
+
+  using T = std::underlying_type_t<E>;
+  using P = decltype(+T{});
+  P    number{};
+  auto result = std::from_chars(first, last, number);
+  if (result.ec == std::errc{}) {
+    if (static_cast<P>(static_cast<T>(number)) != number)
+      result.ec = std::errc::result_out_of_range;
+    else
+      value = static_cast<E>(number);
+  }
+  return result;
+}
+
+} // namespace enchantum
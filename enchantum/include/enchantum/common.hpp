@@ -104,6 +104,26 @@ inline constexpr bool is_bitflag<E,
 // clang-format on
 #endif
 
+enum class name_lookup_mode : unsigned char {
+  linear,
+  perfect_hash,
+  trie,
+  padded,
+};
+
+// specialize this to choose how `cast` and `contains` find a name
+template<typename E>
+inline constexpr name_lookup_mode name_lookup = name_lookup_mode::linear;
+
+enum class to_string_lookup_mode : unsigned char {
+  index,
+  switch_case,
+};
+
+// specialize this to choose how `to_string` finds the name of a value
+template<typename E>
+inline constexpr to_string_lookup_mode to_string_lookup = to_string_lookup_mode::index;
+
 
 namespace details {
   template<typename T, typename U>
@@ -0,0 +1,82 @@
+#pragma once
+#include "array.hpp"
+#include "details/shard.hpp"
+#include "enchantum.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// one shard per core on the large hosts this is meant for, with more threads than shards the threads share the shards
+// round robin and contend again. Every shard is `count<E> * 8` bytes rounded up to cache lines
+#ifndef ENCHANTUM_COUNTER_SHARDS
+  #define ENCHANTUM_COUNTER_SHARDS 64
+#endif
+
+namespace enchantum {
+
+// a counter per member of `E` split into `Shards` cache line aligned copies, each thread increments its own copy
+// so threads do not fight over the same cache line. Reads add up every shard.
+template<typename E, std::size_t Shards = ENCHANTUM_COUNTER_SHARDS>
+class counter_array {
+  static_assert(std::is_enum_v<E>);
+  static_assert(Shards != 0, "enchantum::counter_array requires at least one shard");
+
+  struct alignas(details::cache_line_size) Shard {
+    std::atomic<std::uint64_t> counts[count<E> == 0 ? 1 : count<E>]{};
+  };
+
+  Shard m_shards[Shards];
+
+public:
+  using snapshot_type = array<E, std::uint64_t>;
+
+  static constexpr std::size_t shards = Shards;
+
+  counter_array() noexcept = default;
+
+  counter_array(const counter_array&)            = delete;
+  counter_array& operator=(const counter_array&) = delete;
+
+  // gives false and counts nothing if `value` is not a member of `E`
+  bool add(const E value, const std::uint64_t n = 1) noexcept
+  {
+    const auto i = enchantum::enum_to_index(value);
+    if (!i)
+      return false;
+    m_shards[details::this_thread_shard(Shards)].counts[*i].fetch_add(n, std::memory_order_relaxed);
+    return true;
+  }
+
+  bool increment(const E value) noexcept { return add(value, 1); }
+
+  // the total of `value`, 0 if it is not a member of `E`
+  [[nodiscard]] std::uint64_t load(const E value) const noexcept
+  {
+    const auto i = enchantum::enum_to_index(value);
+    if (!i)
+      return 0;
+    std::uint64_t ret = 0;
+    for (const auto& shard : m_shards)
+      ret += shard.counts[*i].load(std::memory_order_relaxed);
+    return ret;
+  }
+
+  // the totals of every member, increments happening meanwhile may or may not be included
+  [[nodiscard]] snapshot_type snapshot() const noexcept
+  {
+    snapshot_type ret{};
+    for (const auto& shard : m_shards)
+      for (std::size_t i = 0; i < count<E>; ++i)
+        ret[i] += shard.counts[i].load(std::memory_order_relaxed);
+    return ret;
+  }
+
+  void reset() noexcept
+  {
+    for (auto& shard : m_shards)
+      for (auto& c : shard.counts)
+        c.store(0, std::memory_order_relaxed);
+  }
+};
+
+} // namespace enchantum
@@ -0,0 +1,41 @@
+#pragma once
+#include "simd.hpp"
+#include <cstdint>
+
+#if defined(__BMI2__)
+  #include <immintrin.h>
+#endif
+
+namespace enchantum {
+namespace details {
+
+  // packs the bits of `x` selected by `mask` into the low bits of the result
+  constexpr std::uint64_t bit_extract(const std::uint64_t x, std::uint64_t mask) noexcept
+  {
+#if defined(__BMI2__) && defined(__x86_64__)
+    if (!details::is_constant_evaluated())
+      return _pext_u64(x, mask);
+#endif
+    std::uint64_t ret = 0;
+    for (std::uint64_t bit = 1; mask != 0; bit <<= 1, mask &= mask - 1)
+      if ((x & mask & (~mask + 1)) != 0)
+        ret |= bit;
+    return ret;
+  }
+
+  // spreads the low bits of `x` into the bits selected by `mask`, the inverse of `bit_extract`
+  constexpr std::uint64_t bit_deposit(const std::uint64_t x, std::uint64_t mask) noexcept
+  {
+#if defined(__BMI2__) && defined(__x86_64__)
+    if (!details::is_constant_evaluated())
+      return _pdep_u64(x, mask);
+#endif
+    std::uint64_t ret = 0;
+    for (std::uint64_t bit = 1; mask != 0; bit <<= 1, mask &= mask - 1)
+      if ((x & bit) != 0)
+        ret |= mask & (~mask + 1);
+    return ret;
+  }
+
+} // namespace details
+} // namespace enchantum
@@ -0,0 +1,33 @@
+#pragma once
+
+#if (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)) && __has_include(<bit>)
+#include <bit>
+namespace enchantum{
+  namespace details 
+  {
+    using ::std::bit_width;
+  }
+}
+#else
+namespace enchantum{
+  namespace details 
+  {
+    template <typename T>
+    constexpr int bit_width(T x) {
+    if (x == 0) 
+      return 0;
+
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<int>(sizeof(unsigned long long) * 8) - __builtin_clzll(static_cast<unsigned long long>(x));
+#else
+    int width = 0;
+    while (x != 0) {
+        x = static_cast<T>(x >> 1);
+        ++width;
+    }
+    return width;
+#endif
+  }
+  }
+}
+#endif
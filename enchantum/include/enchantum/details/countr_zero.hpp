@@ -17,12 +17,16 @@ namespace enchantum{
     if (x == 0) 
       return sizeof(T) * 8;
 
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(static_cast<unsigned long long>(x));
+#else
     int count = 0;
     while ((x & 1) == 0) {
         x = static_cast<T>(x >> 1);
         ++count;
     }
     return count;
+#endif
   }
   }
 }
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "../bitflags.hpp"
+#include "../enchantum.hpp"
+#include "string_view.hpp"
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <system_error>
+
+namespace enchantum {
+namespace details {
+  template<typename E>
+  using format_integer = decltype(+enchantum::to_underlying(E{}));
+
+  // enough characters for the bitflag names or the number of any value of `E`
+  template<typename E>
+  inline constexpr std::size_t format_buffer_size = [] {
+    constexpr std::size_t digits = std::numeric_limits<format_integer<E>>::digits10 + 2;
+    if constexpr (is_bitflag<E>)
+      return max_bitflag_string_length<E> < digits ? digits : max_bitflag_string_length<E>;
+    else
+      return digits;
+  }();
+
+  // names are given as is, bitflag names and numbers are written into `buffer` of `format_buffer_size<E>`
+  // characters so nothing is allocated
+  template<typename E>
+  string_view format(const E e, char* const buffer) noexcept
+  {
+    if constexpr (is_bitflag<E>) {
+      const auto [ptr, ec] = enchantum::to_string_bitflag(buffer, buffer + format_buffer_size<E>, e);
+      if (ec == std::errc{} && ptr != buffer)
+        return string_view(buffer, static_cast<std::size_t>(ptr - buffer));
+    }
+    else {
+      if (const auto name = enchantum::to_string(e); !name.empty())
+        return name;
+    }
+    // promote using + to select int overload if to underlying returns char
+    const auto [ptr, ec] = std::to_chars(buffer, buffer + format_buffer_size<E>, +enchantum::to_underlying(e));
+    (void)ec;
+    return string_view(buffer, static_cast<std::size_t>(ptr - buffer));
+  }
+} // namespace details
+} // namespace enchantum
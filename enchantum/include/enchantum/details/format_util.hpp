@@ -2,28 +2,235 @@
 
 #include "../bitflags.hpp"
 #include "../enchantum.hpp"
+#include "../type_name.hpp"
+#include "format_buffer.hpp"
+#include "string_view.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
 #include <string>
+#include <system_error>
+#include <type_traits>
 
 namespace enchantum {
 namespace details {
-  template<typename E>
-  std::string format(E e) noexcept
+  enum class FormatMode : char {
+    name,
+    decimal,   // `d`
+    hex,       // `x`
+    upper_hex, // `X`
+    scoped,    // `s`
+    separator, // `|c`
+  };
+
+  struct FormatSpec {
+    FormatMode  mode      = FormatMode::name;
+    char        sep       = '|';
+    char        fill      = ' ';
+    char        align     = '\0';
+    std::size_t width     = 0;
+    std::size_t precision = static_cast<std::size_t>(-1);
+  };
+
+  // the `}` closing the replacement field starting at `first`, nested `{}` are skipped
+  template<typename It>
+  constexpr It format_spec_end(It first, const It last) noexcept
   {
-    if constexpr (is_bitflag<E>) {
-      if (const auto name = enchantum::to_string_bitflag(e); !name.empty()) {
-        if constexpr (std::is_same_v<std::string, string>) {
-          return name;
-        }
-        else {
-          return std::string(name.data(), name.size());
-        }
-      }
+    std::size_t depth = 0;
+    for (; first != last; ++first) {
+      if (*first == '{')
+        ++depth;
+      else if (*first == '}' && depth-- == 0)
+        break;
+    }
+    return first;
+  }
+
+  // whether [first, last) ends with a mode, specs without one are left to `formatter<string_view>`
+  template<typename It>
+  constexpr bool has_format_mode(const It first, const It last) noexcept
+  {
+    if (first == last)
+      return false;
+    auto it = last;
+    --it;
+    const char c = *it;
+    if (c == 'd' || c == 'x' || c == 'X' || c == 's' || c == '|')
+      return true;
+    return it != first && *--it == '|';
+  }
+
+  // parses `[[fill]align][width][.precision]mode`, gives null or what is wrong with it
+  template<typename E, typename It>
+  constexpr const char* parse_format_spec(It first, It last, FormatSpec& spec) noexcept
+  {
+    const auto is_align = [](const char c) { return c == '<' || c == '>' || c == '^'; };
+    const auto is_digit = [](const char c) { return c >= '0' && c <= '9'; };
+
+    auto mode = last;
+    auto prev = --mode;
+    if (*mode == '|') {
+      spec.mode = FormatMode::separator;
+    }
+    else if (mode != first && *--prev == '|') {
+      spec.mode = FormatMode::separator;
+      spec.sep  = *mode;
+      mode      = prev;
     }
     else {
-      if (const auto name = enchantum::to_string(e); !name.empty())
-        return std::string(name.data(), name.size());
+      const char c = *mode;
+      spec.mode    = c == 'd' ? FormatMode::decimal
+        : c == 'x'           ? FormatMode::hex
+        : c == 'X'           ? FormatMode::upper_hex
+                             : FormatMode::scoped;
+    }
+    last = mode;
+    if (spec.mode == FormatMode::separator && !is_bitflag<E>)
+      return "enchantum: the '|' format mode requires a bitflag enum";
+
+    if (first != last) {
+      auto next = first;
+      ++next;
+      if (next != last && is_align(*next)) {
+        spec.fill  = *first;
+        spec.align = *next;
+        first      = ++next;
+      }
+      else if (is_align(*first)) {
+        spec.align = *first;
+        ++first;
+      }
+    }
+    for (; first != last && is_digit(*first); ++first)
+      spec.width = spec.width * 10 + static_cast<std::size_t>(*first - '0');
+    if (first != last && *first == '.') {
+      spec.precision = 0;
+      for (++first; first != last && is_digit(*first); ++first)
+        spec.precision = spec.precision * 10 + static_cast<std::size_t>(*first - '0');
+      if (spec.mode == FormatMode::decimal || spec.mode == FormatMode::hex || spec.mode == FormatMode::upper_hex)
+        return "enchantum: precision is not allowed with the 'd', 'x' and 'X' format modes";
+    }
+    if (first != last)
+      return *first == '{' ? "enchantum: dynamic width and precision are not supported with format modes"
+                           : "enchantum: invalid format spec";
+    return nullptr;
+  }
+
+  // writes `e` as `spec` says into `out` padded to `spec.width`, `body(put)` calls `put(string_view)` for every part
+  // of the `size` characters of the string
+  template<typename OutputIt, typename Func>
+  OutputIt write_padded(OutputIt          out,
+                        const std::size_t size,
+                        const FormatSpec& spec,
+                        const char        default_align,
+                        Func              body)
+  {
+    const auto shown   = size < spec.precision ? size : spec.precision;
+    const auto padding = spec.width > shown ? spec.width - shown : 0;
+    const auto align   = spec.align == '\0' ? default_align : spec.align;
+    const auto before  = align == '>' ? padding : align == '^' ? padding / 2 : 0;
+
+    out              = std::fill_n(out, before, spec.fill);
+    std::size_t left = shown;
+    body([&out, &left](const string_view s) {
+      const auto n = s.size() < left ? s.size() : left;
+      out          = std::copy_n(s.data(), n, out);
+      left -= n;
+    });
+    return std::fill_n(out, padding - before, spec.fill);
+  }
+
+  template<typename E, typename OutputIt>
+  OutputIt format_to(OutputIt out, const E e, const FormatSpec& spec)
+  {
+    using T = std::underlying_type_t<E>;
+    char buffer[format_buffer_size<E> + 1];
+
+    const auto write_string = [&](const string_view s, const char default_align) {
+      return details::write_padded(out, s.size(), spec, default_align, [s](auto put) { put(s); });
+    };
+    const auto write_number = [&](const int base) {
+      std::to_chars_result result{};
+      if (base == 10) {
+        result = std::to_chars(buffer, buffer + sizeof(buffer), +enchantum::to_underlying(e));
+      }
+      else {
+        using U = typename std::
+          conditional_t<std::is_same_v<T, bool>, std::enable_if<true, unsigned>, std::make_unsigned<T>>::type;
+        result  = std::to_chars(buffer, buffer + sizeof(buffer), +static_cast<U>(enchantum::to_underlying(e)), 16);
+        if (spec.mode == FormatMode::upper_hex)
+          for (auto* c = buffer; c != result.ptr; ++c)
+            if (*c >= 'a' && *c <= 'f')
+              *c = static_cast<char>(*c - 'a' + 'A');
+      }
+      return write_string(string_view(buffer, static_cast<std::size_t>(result.ptr - buffer)), '>');
+    };
+
+    switch (spec.mode) {
+    case FormatMode::decimal: return write_number(10);
+    case FormatMode::hex:
+    case FormatMode::upper_hex: return write_number(16);
+    case FormatMode::separator:
+      if constexpr (is_bitflag<E>) {
+        const auto [ptr, ec] = enchantum::to_string_bitflag(buffer, buffer + sizeof(buffer), e, spec.sep);
+        if (ec == std::errc{} && ptr != buffer)
+          return write_string(string_view(buffer, static_cast<std::size_t>(ptr - buffer)), '<');
+      }
+      return write_number(10);
+    case FormatMode::scoped: {
+      constexpr auto scope = type_name<E>;
+      if constexpr (is_bitflag<E>) {
+        const bool  zero       = has_zero_flag<E> && static_cast<T>(e) == 0;
+        std::size_t size       = 0;
+        std::size_t flags      = 0;
+        const auto  count_flag = [&](const std::size_t i) {
+          size += scope.size() + 2 + names_generator<E>[i].size();
+          ++flags;
+        };
+        if (zero)
+          count_flag(0);
+        else if (!details::for_each_flag_index<E>(static_cast<T>(e), count_flag) || flags == 0)
+          return write_number(10);
+        size += flags - 1;
+        return details::write_padded(out, size, spec, '<', [&](auto put) {
+          bool       first    = true;
+          const auto put_flag = [&](const std::size_t i) {
+            if (!first)
+              put(string_view(&spec.sep, 1));
+            first = false;
+            put(scope);
+            put(string_view("::", 2));
+            put(names_generator<E>[i]);
+          };
+          if (zero)
+            put_flag(0);
+          else
+            details::for_each_flag_index<E>(static_cast<T>(e), put_flag);
+        });
+      }
+      else {
+        const auto i = enchantum::enum_to_index(e);
+        if (!i)
+          return write_number(10);
+        const auto name = names_generator<E>[*i];
+        return details::write_padded(out, scope.size() + 2 + name.size(), spec, '<', [&](auto put) {
+          put(scope);
+          put(string_view("::", 2));
+          put(name);
+        });
+      }
+    }
+    case FormatMode::name: break;
     }
-    return std::to_string(+enchantum::to_underlying(e)); // promote using + to select int overload if to underlying returns char
+    return write_string(details::format(e, buffer), '<');
+  }
+
+  template<typename E>
+  std::string format(E e) noexcept
+  {
+    char       buffer[format_buffer_size<E>];
+    const auto s = details::format(e, buffer);
+    return std::string(s.data(), s.size());
   }
 } // namespace details
-} // namespace enchantum
\ No newline at end of file
+} // namespace enchantum
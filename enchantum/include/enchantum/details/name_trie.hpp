@@ -0,0 +1,168 @@
+#pragma once
+#include "../entries.hpp"
+#include "../generators.hpp"
+#include "string_view.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace enchantum {
+namespace details {
+
+  struct TrieNode {
+    // character position this node branches on
+    std::uint16_t position   = 0;
+    std::uint16_t first_edge = 0;
+    // 0 for leaves
+    std::uint16_t edge_count = 0;
+    // index of the only name left in a leaf, `count<E>` if there is none
+    std::uint16_t candidate = 0;
+  };
+
+  struct TrieEdge {
+    char          character = 0;
+    std::uint16_t child     = 0;
+  };
+
+  template<std::size_t RootCount, std::size_t NodeCount>
+  struct NameTrie {
+    std::size_t min_size = 0;
+    // one root per name length in [min_size, min_size + RootCount)
+    std::array<std::uint16_t, RootCount> roots{};
+    std::array<TrieNode, NodeCount>      nodes{};
+    std::array<TrieEdge, NodeCount>      edges{};
+  };
+
+  // A decision tree over `names<E>`: the root picks the length then every node branches on the character position
+  // which splits its remaining names the most, so a lookup reads a few bytes before it is down to one candidate.
+  // Positions where all remaining names agree are never branched on and are checked by the final comparison.
+  template<typename E, bool Lowercase>
+  constexpr auto make_name_trie() noexcept
+  {
+    constexpr auto minmax     = details::minmax_string_size(names<E>.data(), names<E>.data() + names<E>.size());
+    constexpr auto root_count = count<E> == 0 ? std::size_t{1} : minmax.second - minmax.first + 1;
+    // every internal node has at least 2 children so there are at most `count<E>` leaves with a name,
+    // `count<E>` internal nodes and one empty leaf per missing length
+    constexpr auto node_count = 2 * count<E> + root_count;
+    static_assert(node_count < UINT16_MAX, "");
+
+    const auto* const strings = details::name_strings<E, Lowercase>();
+    const auto* const indices = details::reflection_string_indices<E, true>.data();
+    const auto        length  = [indices](const std::size_t i) -> std::size_t {
+      return indices[i + 1] - indices[i] - 1;
+    };
+    const auto at = [strings, indices](const std::size_t i, const std::size_t position) {
+      return strings[indices[i] + position];
+    };
+
+    NameTrie<root_count, node_count> ret{};
+    ret.min_size = count<E> == 0 ? 0 : minmax.first;
+
+    // every node owns the range [range_begin, range_end) of `order`
+    std::array<std::uint16_t, count<E> + 1> order{};
+    std::array<std::size_t, node_count>     range_begin{};
+    std::array<std::size_t, node_count>     range_end{};
+    std::size_t                             nodes = 0;
+    std::size_t                             edges = 0;
+
+    std::size_t ordered = 0;
+    for (std::size_t root = 0; root < root_count; ++root) {
+      ret.roots[root]    = static_cast<std::uint16_t>(nodes);
+      range_begin[nodes] = ordered;
+      for (std::size_t i = 0; i < count<E>; ++i)
+        if (length(i) == ret.min_size + root)
+          order[ordered++] = static_cast<std::uint16_t>(i);
+      range_end[nodes++] = ordered;
+    }
+
+    for (std::size_t node = 0; node < nodes; ++node) {
+      const auto begin = range_begin[node];
+      const auto end   = range_end[node];
+
+      auto& current     = ret.nodes[node];
+      current.candidate = static_cast<std::uint16_t>(count<E>);
+      for (std::size_t i = begin; i < end; ++i)
+        current.candidate = order[i] < current.candidate ? order[i] : current.candidate;
+
+      if (end - begin < 2)
+        continue;
+
+      std::size_t best_position = 0;
+      std::size_t best_distinct = 0;
+      for (std::size_t position = 0; position < length(order[begin]); ++position) {
+        std::size_t distinct = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+          bool seen = false;
+          for (std::size_t j = begin; j < i && !seen; ++j)
+            seen = at(order[j], position) == at(order[i], position);
+          distinct += !seen;
+        }
+        if (distinct > best_distinct) {
+          best_distinct = distinct;
+          best_position = position;
+        }
+      }
+      // all remaining names are equal, the first one wins
+      if (best_distinct < 2)
+        continue;
+
+      // stable so equal names keep their order
+      for (std::size_t i = begin + 1; i < end; ++i) {
+        const auto moved = order[i];
+        auto       j     = i;
+        for (; j > begin && at(order[j - 1], best_position) > at(moved, best_position); --j)
+          order[j] = order[j - 1];
+        order[j] = moved;
+      }
+
+      current.position   = static_cast<std::uint16_t>(best_position);
+      current.first_edge = static_cast<std::uint16_t>(edges);
+      for (std::size_t run = begin; run < end;) {
+        const auto c        = at(order[run], best_position);
+        auto       run_end  = run + 1;
+        for (; run_end < end && at(order[run_end], best_position) == c; ++run_end) {}
+        ret.edges[edges++]  = TrieEdge{c, static_cast<std::uint16_t>(nodes)};
+        range_begin[nodes]  = run;
+        range_end[nodes++]  = run_end;
+        ++current.edge_count;
+        run = run_end;
+      }
+    }
+    return ret;
+  }
+
+  template<typename E, bool Lowercase = false>
+  inline constexpr auto name_trie = details::make_name_trie<E, Lowercase>();
+
+  // gives `count<E>` if `name` is not found, `name.size()` must be within the length range of `names<E>`
+  template<typename E, bool Lowercase = false>
+  constexpr std::size_t name_trie_find(const string_view name) noexcept
+  {
+    constexpr auto& trie = name_trie<E, Lowercase>;
+    const auto* const data = name.data();
+    const auto        size = name.size();
+
+    const auto* node = &trie.nodes[trie.roots[size - trie.min_size]];
+    while (node->edge_count != 0) {
+      const char  c    = data[node->position];
+      const auto* edge = &trie.edges[node->first_edge];
+      const auto* last = edge + node->edge_count;
+      for (; edge != last && edge->character != c; ++edge) {}
+      if (edge == last)
+        return count<E>;
+      node = &trie.nodes[edge->child];
+    }
+
+    const std::size_t index = node->candidate;
+    if (index == count<E>)
+      return count<E>;
+
+    const auto* const candidate = details::name_strings<E, Lowercase>() + details::reflection_string_indices<E, true>[index];
+    for (std::size_t i = 0; i < size; ++i)
+      if (candidate[i] != data[i])
+        return count<E>;
+    return index;
+  }
+
+} // namespace details
+} // namespace enchantum
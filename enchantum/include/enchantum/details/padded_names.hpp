@@ -0,0 +1,98 @@
+#pragma once
+#include "../entries.hpp"
+#include "../generators.hpp"
+#include "simd.hpp"
+#include "string_view.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace enchantum {
+namespace details {
+
+  template<std::size_t Width, std::size_t Count, std::size_t LengthCount>
+  struct PaddedNameTable {
+    static constexpr std::size_t width = Width;
+
+    std::size_t min_size = 0;
+    // rows holding names of length `min_size + i` are [length_begin[i], length_begin[i + 1])
+    std::array<std::uint16_t, LengthCount + 1> length_begin{};
+    // index into `names<E>` of each row
+    std::array<std::uint16_t, Count> row_index{};
+    // every name zero padded to `Width` bytes
+    alignas(Width) std::array<char, Count * Width> rows{};
+  };
+
+  template<typename E>
+  inline constexpr std::size_t padded_name_width = [] {
+    constexpr auto size = details::minmax_string_size(names<E>.data(), names<E>.data() + names<E>.size()).second;
+    return size <= 16 ? 16 : size <= 32 ? 32 : 0;
+  }();
+
+  template<typename E, bool Lowercase>
+  constexpr auto make_padded_name_table() noexcept
+  {
+    constexpr auto minmax       = details::minmax_string_size(names<E>.data(), names<E>.data() + names<E>.size());
+    constexpr auto length_count = count<E> == 0 ? std::size_t{1} : minmax.second - minmax.first + 1;
+    constexpr auto width        = padded_name_width<E>;
+    static_assert(width != 0, "names longer than 32 characters can't be padded");
+
+    const auto* const strings = details::name_strings<E, Lowercase>();
+    const auto* const indices = details::reflection_string_indices<E, true>.data();
+
+    PaddedNameTable<width, count<E>, length_count> ret{};
+    ret.min_size = count<E> == 0 ? 0 : minmax.first;
+
+    std::size_t row = 0;
+    for (std::size_t l = 0; l < length_count; ++l) {
+      ret.length_begin[l] = static_cast<std::uint16_t>(row);
+      for (std::size_t i = 0; i < count<E>; ++i) {
+        const std::size_t size = indices[i + 1] - indices[i] - 1;
+        if (size != ret.min_size + l)
+          continue;
+        ret.row_index[row] = static_cast<std::uint16_t>(i);
+        for (std::size_t c = 0; c < size; ++c)
+          ret.rows[row * width + c] = strings[indices[i] + c];
+        ++row;
+      }
+    }
+    ret.length_begin[length_count] = static_cast<std::uint16_t>(row);
+    return ret;
+  }
+
+  template<typename E, bool Lowercase = false>
+  inline constexpr auto padded_name_table = details::make_padded_name_table<E, Lowercase>();
+
+  // gives `count<E>` if `name` is not found, `name.size()` must be within the length range of `names<E>`
+  template<typename E, bool Lowercase = false>
+  constexpr std::size_t padded_name_find(const string_view name) noexcept
+  {
+    constexpr auto& table = padded_name_table<E, Lowercase>;
+    constexpr auto  width = table.width;
+
+    const auto* const data  = name.data();
+    const auto        size  = name.size();
+    std::size_t       first = table.length_begin[size - table.min_size];
+    const std::size_t last  = table.length_begin[size - table.min_size + 1];
+
+    if (details::is_constant_evaluated()) {
+      for (; first != last; ++first) {
+        std::size_t i = 0;
+        for (; i < size && table.rows[first * width + i] == data[i]; ++i) {}
+        if (i == size)
+          return table.row_index[first];
+      }
+      return count<E>;
+    }
+    else {
+      // the zero padding only matches names of the same length which is why rows are grouped by it
+      alignas(width) char input[width]{};
+      std::memcpy(input, data, size);
+      const auto row = details::find_equal_row<width>(input, table.rows.data(), first, last);
+      return row == last ? count<E> : table.row_index[row];
+    }
+  }
+
+} // namespace details
+} // namespace enchantum
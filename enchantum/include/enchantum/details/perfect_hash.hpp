@@ -0,0 +1,178 @@
+#pragma once
+#include "../entries.hpp"
+#include "../generators.hpp"
+#include "string_view.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+namespace enchantum {
+namespace details {
+
+  // FNV-1a
+  constexpr std::uint64_t hash_string(const char* const s, const std::size_t size) noexcept
+  {
+    std::uint64_t h = 0xcbf29ce484222325;
+    for (std::size_t i = 0; i < size; ++i) {
+      h ^= static_cast<unsigned char>(s[i]);
+      h *= 0x100000001b3;
+    }
+    return h;
+  }
+
+  // splitmix64 finalizer keyed by the per bucket seed
+  constexpr std::uint64_t hash_mix(std::uint64_t h, const std::uint64_t seed) noexcept
+  {
+    h ^= seed * 0x9e3779b97f4a7c15;
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111eb;
+    h ^= h >> 31;
+    return h;
+  }
+
+  constexpr std::size_t bit_ceil(const std::size_t n) noexcept
+  {
+    std::size_t r = 1;
+    while (r < n)
+      r <<= 1;
+    return r;
+  }
+
+  template<typename Index, std::size_t BucketCount, std::size_t SlotCount>
+  struct PerfectHashTable {
+    static constexpr std::size_t bucket_count = BucketCount;
+    static constexpr std::size_t slot_count   = SlotCount;
+
+    std::array<std::uint16_t, BucketCount> seeds{};
+    // index + 1 of the name living in this slot, 0 means the slot is empty
+    std::array<Index, SlotCount> slots{};
+    // false if no seed could place a bucket, lookups then fall back to a linear search
+    bool valid = false;
+  };
+
+  // Hash and displace: names are grouped into buckets by their hash then each bucket searches for a seed which
+  // moves all of its names into free slots. Names equal to an earlier name are skipped so the first one wins.
+  template<typename Index, std::size_t BucketCount, std::size_t SlotCount, typename Names>
+  constexpr auto make_perfect_hash_table(const Names& names) noexcept
+  {
+    constexpr std::size_t size = std::tuple_size<Names>::value;
+    static_assert(size < (std::numeric_limits<Index>::max)(), "");
+
+    PerfectHashTable<Index, BucketCount, SlotCount> ret{};
+    std::array<std::uint64_t, size> hashes{};
+    std::array<std::size_t, size>   bucket_of{};
+    std::array<std::size_t, BucketCount> bucket_sizes{};
+
+    for (std::size_t i = 0; i < size; ++i) {
+      hashes[i]    = details::hash_string(names[i].data(), names[i].size());
+      bucket_of[i] = static_cast<std::size_t>(hashes[i] % BucketCount);
+      ++bucket_sizes[bucket_of[i]];
+    }
+
+    std::array<bool, SlotCount> taken{};
+    std::array<std::size_t, size> members{};
+    std::array<std::size_t, SlotCount> placed{};
+
+    // largest buckets first since they are the hardest to place
+    for (std::size_t bucket_size = size; bucket_size != 0; --bucket_size) {
+      for (std::size_t bucket = 0; bucket < BucketCount; ++bucket) {
+        if (bucket_sizes[bucket] != bucket_size)
+          continue;
+
+        std::size_t member_count = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+          if (bucket_of[i] != bucket)
+            continue;
+          bool duplicate = false;
+          for (std::size_t j = 0; j < member_count; ++j) {
+            const auto& other = names[members[j]];
+            if (hashes[members[j]] != hashes[i] || other.size() != names[i].size())
+              continue;
+            duplicate = true;
+            for (std::size_t c = 0; c < other.size(); ++c)
+              if (other.data()[c] != names[i].data()[c])
+                duplicate = false;
+            if (duplicate)
+              break;
+          }
+          if (!duplicate)
+            members[member_count++] = i;
+        }
+
+        bool found = false;
+        for (std::size_t seed = 0; seed <= UINT16_MAX && !found; ++seed) {
+          std::size_t placed_count = 0;
+          for (; placed_count < member_count; ++placed_count) {
+            const auto slot = static_cast<std::size_t>(details::hash_mix(hashes[members[placed_count]], seed) %
+                                                       SlotCount);
+            if (taken[slot])
+              break;
+            taken[slot]          = true;
+            placed[placed_count] = slot;
+          }
+          if (placed_count == member_count) {
+            found              = true;
+            ret.seeds[bucket]  = static_cast<std::uint16_t>(seed);
+            for (std::size_t j = 0; j < member_count; ++j)
+              ret.slots[placed[j]] = static_cast<Index>(members[j] + 1);
+          }
+          else {
+            for (std::size_t j = 0; j < placed_count; ++j)
+              taken[placed[j]] = false;
+          }
+        }
+        if (!found)
+          return ret;
+      }
+    }
+    ret.valid = true;
+    return ret;
+  }
+
+  template<typename E, bool Lowercase>
+  constexpr const auto& hashed_names() noexcept
+  {
+    if constexpr (Lowercase)
+      return lowercase_names<E>;
+    else
+      return names<E>;
+  }
+
+  template<typename E, bool Lowercase = false>
+  inline constexpr auto name_hash_table = details::make_perfect_hash_table<
+    std::conditional_t<(count<E> < UINT8_MAX), std::uint8_t, std::uint16_t>,
+    details::Max(std::size_t{1}, details::bit_ceil(count<E>) / 2),
+    details::bit_ceil(count<E>) * 2>(details::hashed_names<E, Lowercase>());
+
+  // gives `count<E>` if `name` is not found
+  template<typename E, bool Lowercase = false>
+  constexpr std::size_t perfect_hash_find(const string_view name) noexcept
+  {
+    using Table           = std::remove_cv_t<decltype(name_hash_table<E, Lowercase>)>;
+    constexpr auto& table = name_hash_table<E, Lowercase>;
+
+    const auto* const data  = name.data();
+    const auto        size  = name.size();
+    const auto        h     = details::hash_string(data, size);
+    const auto        seed  = table.seeds[static_cast<std::size_t>(h % Table::bucket_count)];
+    const std::size_t index = table.slots[static_cast<std::size_t>(details::hash_mix(h, seed) % Table::slot_count)];
+    if (index == 0)
+      return count<E>;
+
+    constexpr auto&   indices   = reflection_string_indices<E, true>;
+    const auto* const candidate = details::name_strings<E, Lowercase>() + indices[index - 1];
+    if (std::size_t(indices[index] - indices[index - 1] - 1) != size)
+      return count<E>;
+    for (std::size_t i = 0; i < size; ++i)
+      if (candidate[i] != data[i])
+        return count<E>;
+    return index - 1;
+  }
+
+} // namespace details
+} // namespace enchantum
@@ -0,0 +1,29 @@
+#pragma once
+#if (__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)) && __has_include(<bit>)
+#include <bit>
+namespace enchantum{
+  namespace details
+  {
+    using ::std::popcount;
+  }
+}
+#else
+#include <cstdint>
+namespace enchantum{
+  namespace details
+  {
+    template <typename T>
+    constexpr int popcount(const T x) {
+#if defined(__GNUC__) || defined(__clang__)
+      return __builtin_popcountll(static_cast<unsigned long long>(x));
+#else
+      auto v = static_cast<std::uint64_t>(x);
+      v = v - ((v >> 1) & 0x5555555555555555);
+      v = (v & 0x3333333333333333) + ((v >> 2) & 0x3333333333333333);
+      v = (v + (v >> 4)) & 0x0f0f0f0f0f0f0f0f;
+      return static_cast<int>((v * 0x0101010101010101) >> 56);
+#endif
+    }
+  }
+}
+#endif
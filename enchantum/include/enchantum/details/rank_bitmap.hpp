@@ -0,0 +1,62 @@
+#pragma once
+#include "../entries.hpp"
+#include "popcount.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace enchantum {
+namespace details {
+
+  static_assert(ENCHANTUM_RANK_BITMAP_MAX_RANGE <= 65535, "ENCHANTUM_RANK_BITMAP_MAX_RANGE must fit the std::uint16_t ranks");
+
+  template<std::size_t Words>
+  struct RankBitmap {
+    // bit `i` is set if `min<E> + i` is a member
+    std::array<std::uint64_t, Words> bits{};
+    // amount of members in all the words before this one
+    std::array<std::uint16_t, Words> ranks{};
+  };
+
+  template<typename E>
+  constexpr auto make_rank_bitmap() noexcept
+  {
+    constexpr auto words = static_cast<std::size_t>(details::offset_from_min<E>(enchantum::to_underlying(max<E>)) / 64 + 1);
+
+    RankBitmap<words> ret{};
+    for (const auto v : values<E>) {
+      const auto offset = details::offset_from_min<E>(enchantum::to_underlying(v));
+      ret.bits[static_cast<std::size_t>(offset / 64)] |= std::uint64_t{1} << (offset % 64);
+    }
+
+    std::uint16_t rank = 0;
+    for (std::size_t i = 0; i < words; ++i) {
+      ret.ranks[i] = rank;
+      rank         = static_cast<std::uint16_t>(rank + details::popcount(ret.bits[i]));
+    }
+    return ret;
+  }
+
+  template<typename E>
+  inline constexpr auto rank_bitmap = details::make_rank_bitmap<E>();
+
+  // gives `count<E>` if `value` is not a member
+  template<typename E>
+  constexpr std::size_t rank_bitmap_index(const std::underlying_type_t<E> value) noexcept
+  {
+    constexpr auto& bitmap = rank_bitmap<E>;
+
+    const auto offset = details::offset_from_min<E>(value);
+    if (offset >= bitmap.bits.size() * 64)
+      return count<E>;
+
+    const auto i    = static_cast<std::size_t>(offset / 64);
+    const auto bit  = static_cast<unsigned>(offset % 64);
+    const auto word = bitmap.bits[i];
+    if (((word >> bit) & 1) == 0)
+      return count<E>;
+    return bitmap.ranks[i] + static_cast<std::size_t>(details::popcount(word & ((std::uint64_t{1} << bit) - 1)));
+  }
+
+} // namespace details
+} // namespace enchantum
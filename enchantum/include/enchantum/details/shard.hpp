@@ -0,0 +1,23 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+#ifndef ENCHANTUM_CACHE_LINE_SIZE
+  #define ENCHANTUM_CACHE_LINE_SIZE 64
+#endif
+
+namespace enchantum {
+namespace details {
+
+  inline constexpr std::size_t cache_line_size = ENCHANTUM_CACHE_LINE_SIZE;
+
+  // every thread gets the next index the first time it asks so threads spread evenly over the shards
+  inline std::size_t this_thread_shard(const std::size_t shards) noexcept
+  {
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t  index = next.fetch_add(1, std::memory_order_relaxed);
+    return index % shards;
+  }
+
+} // namespace details
+} // namespace enchantum
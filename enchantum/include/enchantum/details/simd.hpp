@@ -0,0 +1,84 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define ENCHANTUM_DETAILS_SSE2 1
+  #include <emmintrin.h>
+#endif
+
+namespace enchantum {
+namespace details {
+
+  constexpr bool is_constant_evaluated() noexcept
+  {
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#else
+    return __builtin_is_constant_evaluated();
+#endif
+  }
+
+  // `input` is loaded once then compared against each `Width` byte row in [first,last)
+  // gives the first equal row or `last`
+  template<std::size_t Width>
+  inline std::size_t find_equal_row(const char* const input,
+                                    const char* const rows,
+                                    std::size_t       first,
+                                    const std::size_t last) noexcept
+  {
+    static_assert(Width == 16 || Width == 32, "");
+#if defined(__AVX2__)
+    if constexpr (Width == 32) {
+      const auto in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+      for (; first != last; ++first) {
+        const auto row = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rows + first * Width));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(in, row)) == -1)
+          return first;
+      }
+      return last;
+    }
+    else
+#endif
+#if defined(ENCHANTUM_DETAILS_SSE2)
+    {
+      __m128i in[Width / 16];
+      for (std::size_t i = 0; i < Width / 16; ++i)
+        in[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i * 16));
+      for (; first != last; ++first) {
+        int mask = 0xFFFF;
+        for (std::size_t i = 0; i < Width / 16; ++i) {
+          const auto row = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + first * Width + i * 16));
+          mask &= _mm_movemask_epi8(_mm_cmpeq_epi8(in[i], row));
+        }
+        if (mask == 0xFFFF)
+          return first;
+      }
+      return last;
+    }
+#else
+    {
+      std::uint64_t in[Width / 8];
+      std::memcpy(in, input, Width);
+      for (; first != last; ++first) {
+        std::uint64_t diff = 0;
+        for (std::size_t i = 0; i < Width / 8; ++i) {
+          std::uint64_t row;
+          std::memcpy(&row, rows + first * Width + i * 8, 8);
+          diff |= row ^ in[i];
+        }
+        if (diff == 0)
+          return first;
+      }
+      return last;
+    }
+#endif
+  }
+
+} // namespace details
+} // namespace enchantum
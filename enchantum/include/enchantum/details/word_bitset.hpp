@@ -0,0 +1,491 @@
+#pragma once
+#include "../common.hpp"
+#include "countr_zero.hpp"
+#include "popcount.hpp"
+#include "simd.hpp"
+#include "string.hpp"
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <stdexcept>
+#include <string>
+
+#if defined(ENCAHNTUM_DETAILS_GCC_MAJOR) && ENCAHNTUM_DETAILS_GCC_MAJOR <= 10
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wconversion"
+#endif
+
+namespace enchantum {
+namespace details {
+
+  enum class word_op {
+    bit_and,
+    bit_or,
+    bit_xor,
+    bit_and_not,
+  };
+
+  template<word_op Op>
+  constexpr std::uint64_t apply_word_op(const std::uint64_t a, const std::uint64_t b) noexcept
+  {
+    if constexpr (Op == word_op::bit_and)
+      return a & b;
+    else if constexpr (Op == word_op::bit_or)
+      return a | b;
+    else if constexpr (Op == word_op::bit_xor)
+      return a ^ b;
+    else
+      return a & ~b;
+  }
+
+  // `dst[i] = dst[i] Op src[i]` for every word, a vector at a time when available
+  template<word_op Op>
+  inline void apply_word_op_simd(std::uint64_t* const dst, const std::uint64_t* const src, const std::size_t count) noexcept
+  {
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 4 <= count; i += 4) {
+      const auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+      const auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+      __m256i    r;
+      if constexpr (Op == word_op::bit_and)
+        r = _mm256_and_si256(a, b);
+      else if constexpr (Op == word_op::bit_or)
+        r = _mm256_or_si256(a, b);
+      else if constexpr (Op == word_op::bit_xor)
+        r = _mm256_xor_si256(a, b);
+      else
+        r = _mm256_andnot_si256(b, a);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), r);
+    }
+#endif
+#if defined(ENCHANTUM_DETAILS_SSE2)
+    for (; i + 2 <= count; i += 2) {
+      const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+      const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+      __m128i    r;
+      if constexpr (Op == word_op::bit_and)
+        r = _mm_and_si128(a, b);
+      else if constexpr (Op == word_op::bit_or)
+        r = _mm_or_si128(a, b);
+      else if constexpr (Op == word_op::bit_xor)
+        r = _mm_xor_si128(a, b);
+      else
+        r = _mm_andnot_si128(b, a);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), r);
+    }
+#endif
+    for (; i < count; ++i)
+      dst[i] = details::apply_word_op<Op>(dst[i], src[i]);
+  }
+
+  // `std::bitset` made of `std::uint64_t` words which is constexpr in every standard and gives access to its words.
+  // Bits past `N` are always zero.
+  template<std::size_t N>
+  class word_bitset {
+  public:
+    using word_type                              = std::uint64_t;
+    static constexpr std::size_t bits_per_word   = 64;
+    static constexpr std::size_t word_count      = N == 0 ? 1 : (N + bits_per_word - 1) / bits_per_word;
+  private:
+    static constexpr word_type last_word_mask = N == 0 ? 0
+      : N % bits_per_word == 0                         ? ~word_type{0}
+                                                       : (word_type{1} << (N % bits_per_word)) - 1;
+
+    word_type m_words[word_count]{};
+
+    constexpr void trim() noexcept { m_words[word_count - 1] &= last_word_mask; }
+
+    template<word_op Op>
+    constexpr word_bitset& apply(const word_bitset& other) noexcept
+    {
+      if constexpr (N > 256) {
+        if (!details::is_constant_evaluated()) {
+          details::apply_word_op_simd<Op>(m_words, other.m_words, word_count);
+          return *this;
+        }
+      }
+      for (std::size_t i = 0; i < word_count; ++i)
+        m_words[i] = details::apply_word_op<Op>(m_words[i], other.m_words[i]);
+      return *this;
+    }
+
+    static constexpr word_type bit(const std::size_t pos) noexcept { return word_type{1} << (pos % bits_per_word); }
+
+  public:
+    class reference {
+      friend class word_bitset;
+      word_type* m_word;
+      word_type  m_mask;
+
+      constexpr reference(word_type* const word, const word_type mask) noexcept : m_word(word), m_mask(mask) {}
+    public:
+      constexpr reference(const reference&) noexcept = default;
+
+      constexpr reference& operator=(const bool value) noexcept
+      {
+        if (value)
+          *m_word |= m_mask;
+        else
+          *m_word &= ~m_mask;
+        return *this;
+      }
+
+      constexpr reference& operator=(const reference& other) noexcept { return *this = bool(other); }
+
+      constexpr operator bool() const noexcept { return (*m_word & m_mask) != 0; }
+      constexpr bool operator~() const noexcept { return (*m_word & m_mask) == 0; }
+
+      constexpr reference& flip() noexcept
+      {
+        *m_word ^= m_mask;
+        return *this;
+      }
+    };
+
+    constexpr word_bitset() noexcept = default;
+
+    constexpr word_bitset(const unsigned long long value) noexcept
+    {
+      m_words[0] = static_cast<word_type>(value);
+      trim();
+    }
+
+    // characters of `str` are read from the most significant bit down, like `std::bitset`
+    template<typename CharT>
+    explicit constexpr word_bitset(const CharT* const str,
+                                   const std::size_t  n    = static_cast<std::size_t>(-1),
+                                   const CharT        zero = CharT('0'),
+                                   const CharT        one  = CharT('1'))
+    {
+      std::size_t size = 0;
+      while (size != n && str[size] != '\0')
+        ++size;
+      assign_chars(str, size, zero, one);
+    }
+
+    explicit word_bitset(const string&     str,
+                         const std::size_t pos  = 0,
+                         const std::size_t n    = static_cast<std::size_t>(-1),
+                         const char        zero = '0',
+                         const char        one  = '1')
+    {
+      if (pos > str.size())
+        ENCHANTUM_THROW(std::out_of_range("enchantum::details::word_bitset position out of range"), pos);
+      const auto size = str.size() - pos < n ? str.size() - pos : n;
+      assign_chars(str.data() + pos, size, zero, one);
+    }
+
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return N; }
+
+    [[nodiscard]] constexpr word_type word(const std::size_t i) const noexcept { return m_words[i]; }
+
+    // bits past `N` are dropped
+    constexpr void set_word(const std::size_t i, const word_type value) noexcept
+    {
+      m_words[i] = value;
+      trim();
+    }
+
+    [[nodiscard]] constexpr bool operator[](const std::size_t pos) const noexcept
+    {
+      return (m_words[pos / bits_per_word] & bit(pos)) != 0;
+    }
+
+    [[nodiscard]] constexpr reference operator[](const std::size_t pos) noexcept
+    {
+      return reference(m_words + pos / bits_per_word, bit(pos));
+    }
+
+    [[nodiscard]] constexpr bool test(const std::size_t pos) const
+    {
+      if (pos >= N)
+        ENCHANTUM_THROW(std::out_of_range("enchantum::details::word_bitset::test out of range"), pos);
+      return (*this)[pos];
+    }
+
+    [[nodiscard]] constexpr std::size_t count() const noexcept
+    {
+      std::size_t ret = 0;
+      for (const auto w : m_words)
+        ret += static_cast<std::size_t>(details::popcount(w));
+      return ret;
+    }
+
+    [[nodiscard]] constexpr bool any() const noexcept
+    {
+      for (const auto w : m_words)
+        if (w != 0)
+          return true;
+      return false;
+    }
+
+    [[nodiscard]] constexpr bool none() const noexcept { return !any(); }
+
+    [[nodiscard]] constexpr bool all() const noexcept
+    {
+      for (std::size_t i = 0; i + 1 < word_count; ++i)
+        if (m_words[i] != ~word_type{0})
+          return false;
+      return m_words[word_count - 1] == last_word_mask;
+    }
+
+    // index of the first set bit or `size()` if there is none
+    [[nodiscard]] constexpr std::size_t find_first() const noexcept
+    {
+      for (std::size_t i = 0; i < word_count; ++i)
+        if (m_words[i] != 0)
+          return i * bits_per_word + static_cast<std::size_t>(details::countr_zero(m_words[i]));
+      return N;
+    }
+
+    // index of the first set bit after `pos` or `size()` if there is none
+    [[nodiscard]] constexpr std::size_t find_next(std::size_t pos) const noexcept
+    {
+      if (++pos >= N)
+        return N;
+      auto i = pos / bits_per_word;
+      auto w = m_words[i] & (~word_type{0} << (pos % bits_per_word));
+      while (w == 0) {
+        if (++i == word_count)
+          return N;
+        w = m_words[i];
+      }
+      return i * bits_per_word + static_cast<std::size_t>(details::countr_zero(w));
+    }
+
+    constexpr word_bitset& set() noexcept
+    {
+      for (auto& w : m_words)
+        w = ~word_type{0};
+      trim();
+      return *this;
+    }
+
+    constexpr word_bitset& set(const std::size_t pos, const bool value = true)
+    {
+      if (pos >= N)
+        ENCHANTUM_THROW(std::out_of_range("enchantum::details::word_bitset::set out of range"), pos);
+      (*this)[pos] = value;
+      return *this;
+    }
+
+    constexpr word_bitset& reset() noexcept
+    {
+      for (auto& w : m_words)
+        w = 0;
+      return *this;
+    }
+
+    constexpr word_bitset& reset(const std::size_t pos)
+    {
+      if (pos >= N)
+        ENCHANTUM_THROW(std::out_of_range("enchantum::details::word_bitset::reset out of range"), pos);
+      m_words[pos / bits_per_word] &= ~bit(pos);
+      return *this;
+    }
+
+    constexpr word_bitset& flip() noexcept
+    {
+      for (auto& w : m_words)
+        w = ~w;
+      trim();
+      return *this;
+    }
+
+    constexpr word_bitset& flip(const std::size_t pos)
+    {
+      if (pos >= N)
+        ENCHANTUM_THROW(std::out_of_range("enchantum::details::word_bitset::flip out of range"), pos);
+      m_words[pos / bits_per_word] ^= bit(pos);
+      return *this;
+    }
+
+    constexpr word_bitset& operator&=(const word_bitset& other) noexcept { return apply<word_op::bit_and>(other); }
+    constexpr word_bitset& operator|=(const word_bitset& other) noexcept { return apply<word_op::bit_or>(other); }
+    constexpr word_bitset& operator^=(const word_bitset& other) noexcept { return apply<word_op::bit_xor>(other); }
+
+    // `*this &= ~other` without making `~other`
+    constexpr word_bitset& and_not(const word_bitset& other) noexcept { return apply<word_op::bit_and_not>(other); }
+
+    constexpr word_bitset& operator<<=(const std::size_t n) noexcept
+    {
+      if (n >= N)
+        return reset();
+      const auto shift  = n / bits_per_word;
+      const auto offset = n % bits_per_word;
+      for (auto i = word_count; i-- > 0;) {
+        word_type w = 0;
+        if (i >= shift) {
+          w = m_words[i - shift] << offset;
+          if (offset != 0 && i > shift)
+            w |= m_words[i - shift - 1] >> (bits_per_word - offset);
+        }
+        m_words[i] = w;
+      }
+      trim();
+      return *this;
+    }
+
+    constexpr word_bitset& operator>>=(const std::size_t n) noexcept
+    {
+      if (n >= N)
+        return reset();
+      const auto shift  = n / bits_per_word;
+      const auto offset = n % bits_per_word;
+      for (std::size_t i = 0; i < word_count; ++i) {
+        word_type w = 0;
+        if (i + shift < word_count) {
+          w = m_words[i + shift] >> offset;
+          if (offset != 0 && i + shift + 1 < word_count)
+            w |= m_words[i + shift + 1] << (bits_per_word - offset);
+        }
+        m_words[i] = w;
+      }
+      return *this;
+    }
+
+    [[nodiscard]] constexpr word_bitset operator~() const noexcept { return word_bitset(*this).flip(); }
+    [[nodiscard]] constexpr word_bitset operator<<(const std::size_t n) const noexcept { return word_bitset(*this) <<= n; }
+    [[nodiscard]] constexpr word_bitset operator>>(const std::size_t n) const noexcept { return word_bitset(*this) >>= n; }
+
+    [[nodiscard]] constexpr bool operator==(const word_bitset& other) const noexcept
+    {
+      for (std::size_t i = 0; i < word_count; ++i)
+        if (m_words[i] != other.m_words[i])
+          return false;
+      return true;
+    }
+
+    [[nodiscard]] constexpr bool operator!=(const word_bitset& other) const noexcept { return !(*this == other); }
+
+    [[nodiscard]] constexpr unsigned long long to_ullong() const
+    {
+      for (std::size_t i = 1; i < word_count; ++i)
+        if (m_words[i] != 0)
+          ENCHANTUM_THROW(std::overflow_error("enchantum::details::word_bitset::to_ullong overflow"), i);
+      return static_cast<unsigned long long>(m_words[0]);
+    }
+
+    [[nodiscard]] constexpr unsigned long to_ulong() const
+    {
+      const auto value = to_ullong();
+      if constexpr (sizeof(unsigned long) < sizeof(unsigned long long))
+        if (value > ULONG_MAX)
+          ENCHANTUM_THROW(std::overflow_error("enchantum::details::word_bitset::to_ulong overflow"), value);
+      return static_cast<unsigned long>(value);
+    }
+
+    // the most significant bit first, like `std::bitset`
+    [[nodiscard]] constexpr string to_string(const char zero = '0', const char one = '1') const
+    {
+      string ret(N, zero);
+      for (auto i = find_first(); i != N; i = find_next(i))
+        ret[N - 1 - i] = one;
+      return ret;
+    }
+
+  private:
+    template<typename CharT>
+    constexpr void assign_chars(const CharT* const str, const std::size_t size, const CharT zero, const CharT one)
+    {
+      const auto used = size < N ? size : N;
+      for (std::size_t i = 0; i < size; ++i)
+        if (str[i] != zero && str[i] != one)
+          ENCHANTUM_THROW(std::invalid_argument("enchantum::details::word_bitset invalid character"), i);
+      for (std::size_t i = 0; i < used; ++i)
+        if (str[used - 1 - i] == one)
+          m_words[i / bits_per_word] |= bit(i);
+    }
+  };
+
+  template<std::size_t N>
+  [[nodiscard]] constexpr word_bitset<N> operator&(const word_bitset<N>& a, const word_bitset<N>& b) noexcept
+  {
+    return word_bitset<N>(a) &= b;
+  }
+
+  template<std::size_t N>
+  [[nodiscard]] constexpr word_bitset<N> operator|(const word_bitset<N>& a, const word_bitset<N>& b) noexcept
+  {
+    return word_bitset<N>(a) |= b;
+  }
+
+  template<std::size_t N>
+  [[nodiscard]] constexpr word_bitset<N> operator^(const word_bitset<N>& a, const word_bitset<N>& b) noexcept
+  {
+    return word_bitset<N>(a) ^= b;
+  }
+
+  // writes the bits the most significant first with the `'0'` and `'1'` of the stream, like `std::bitset`
+  template<typename CharT, typename Traits, std::size_t N>
+  std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const word_bitset<N>& bitset)
+  {
+    std::basic_string<CharT, Traits> s(N, os.widen('0'));
+    for (auto i = bitset.find_first(); i != N; i = bitset.find_next(i))
+      s[N - 1 - i] = os.widen('1');
+    return os << s;
+  }
+
+  // reads at most `N` of the `'0'` and `'1'` of the stream the most significant first, like `std::bitset`.
+  // Fails if there is none
+  template<typename CharT, typename Traits, std::size_t N>
+  std::basic_istream<CharT, Traits>& operator>>(std::basic_istream<CharT, Traits>& is, word_bitset<N>& bitset)
+  {
+    using istream = std::basic_istream<CharT, Traits>;
+    const typename istream::sentry sentry(is);
+    if (!sentry)
+      return is;
+
+    const CharT               zero  = is.widen('0');
+    const CharT               one   = is.widen('1');
+    auto&                     buf   = *is.rdbuf();
+    typename istream::iostate state = istream::goodbit;
+    word_bitset<N>            value;
+    std::size_t               n = 0;
+    for (; n != N; ++n) {
+      const auto c = buf.sgetc();
+      if (Traits::eq_int_type(c, Traits::eof())) {
+        state |= istream::eofbit;
+        break;
+      }
+      const auto ch = Traits::to_char_type(c);
+      if (!Traits::eq(ch, zero) && !Traits::eq(ch, one))
+        break;
+      value <<= 1;
+      value[0] = Traits::eq(ch, one);
+      buf.sbumpc();
+    }
+    if (n == 0 && N != 0)
+      state |= istream::failbit;
+    else
+      bitset = value;
+    is.setstate(state);
+    return is;
+  }
+
+  template<typename T>
+  inline constexpr bool is_word_bitset = false;
+
+  template<std::size_t N>
+  inline constexpr bool is_word_bitset<word_bitset<N>> = true;
+
+} // namespace details
+} // namespace enchantum
+
+template<std::size_t N>
+struct std::hash<enchantum::details::word_bitset<N>> {
+  std::size_t operator()(const enchantum::details::word_bitset<N>& bitset) const noexcept
+  {
+    std::size_t ret = 0;
+    for (std::size_t i = 0; i < bitset.word_count; ++i)
+      ret = ret * 31 + std::hash<std::uint64_t>{}(bitset.word(i));
+    return ret;
+  }
+};
+
+#if defined(ENCAHNTUM_DETAILS_GCC_MAJOR) && ENCAHNTUM_DETAILS_GCC_MAJOR <= 10
+  #pragma GCC diagnostic pop
+#endif
@@ -1,7 +1,11 @@
 #pragma once
 
 #include "common.hpp"
+#include "details/name_trie.hpp"
 #include "details/optional.hpp"
+#include "details/padded_names.hpp"
+#include "details/perfect_hash.hpp"
+#include "details/rank_bitmap.hpp"
 #include "details/string_view.hpp"
 #include "entries.hpp"
 #include "generators.hpp"
@@ -40,17 +44,60 @@ namespace details {
     }
   }
 
-  constexpr std::pair<std::size_t, std::size_t> minmax_string_size(const string_view* begin, const string_view* const end)
+  // gives `count<E>` if `name` is not found, `Lowercase` searches the lowercased names
+  template<typename E, bool Lowercase = false>
+  constexpr std::size_t name_to_index(const string_view name) noexcept
   {
-    using T     = std::size_t;
-    auto minmax = std::pair<T, T>(std::numeric_limits<T>::max(), 0);
+    constexpr auto minmax = details::minmax_string_size(names<E>.data(), names<E>.data() + names<E>.size());
+    if (const auto size = name.size(); size < minmax.first || size > minmax.second)
+      return count<E>;
 
-    for (; begin != end; ++begin) {
-      const auto size = begin->size();
-      minmax.first    = minmax.first < size ? minmax.first : size;
-      minmax.second   = minmax.second > size ? minmax.second : size;
+    if constexpr (name_lookup<E> == name_lookup_mode::perfect_hash) {
+      if constexpr (name_hash_table<E, Lowercase>.valid)
+        return details::perfect_hash_find<E, Lowercase>(name);
     }
-    return minmax;
+    else if constexpr (name_lookup<E> == name_lookup_mode::trie) {
+      return details::name_trie_find<E, Lowercase>(name);
+    }
+    else if constexpr (name_lookup<E> == name_lookup_mode::padded) {
+      if constexpr (padded_name_width<E> != 0)
+        return details::padded_name_find<E, Lowercase>(name);
+    }
+
+    if constexpr (Lowercase) {
+      const auto size = name.size();
+      const auto data = name.data();
+      for (std::size_t i = 0; i < count<E>; ++i) {
+        const auto s = lowercase_names<E>[i];
+        if (s.size() != size)
+          continue;
+        std::size_t j = 0;
+        for (; j < size && s.data()[j] == data[j]; ++j) {}
+        if (j == size)
+          return i;
+      }
+    }
+    else {
+      for (std::size_t i = 0; i < count<E>; ++i)
+        if (names_generator<E>[i] == name)
+          return i;
+    }
+    return count<E>;
+  }
+
+  // folds ASCII letters of `name` once then searches the lowercased names
+  template<typename E>
+  constexpr std::size_t icase_name_to_index(const string_view name) noexcept
+  {
+    constexpr auto minmax = details::minmax_string_size(names<E>.data(), names<E>.data() + names<E>.size());
+    const auto     size   = name.size();
+    if (size < minmax.first || size > minmax.second)
+      return count<E>;
+
+    char folded[details::Max(minmax.second, std::size_t{1})]{};
+    for (std::size_t i = 0; i < size; ++i)
+      folded[i] = details::ascii_to_lower(name.data()[i]);
+    return details::name_to_index<E, true>(string_view(folded, size));
   }
 
 } // namespace details
@@ -76,6 +123,9 @@ template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
   else if constexpr (is_contiguous<E>) {
     return true;
   }
+  else if constexpr (index_layout<E> == index_layout_mode::rank_bitmap) {
+    return details::rank_bitmap_index<E>(value) != count<E>;
+  }
   else {
     for (const auto v : values_generator<E>)
       if (static_cast<T>(v) == value)
@@ -93,17 +143,17 @@ template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
 template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
 [[nodiscard]] constexpr bool contains(const string_view name) noexcept
 {
-  constexpr auto minmax = details::minmax_string_size(names<E>.data(), names<E>.data() + names<E>.size());
-  if (const auto size = name.size(); size < minmax.first || size > minmax.second)
-    return false;
-
-  for (const auto s : names_generator<E>)
-    if (s == name)
-      return true;
-  return false;
+  return details::name_to_index<E>(name) != count<E>;
 }
 
 
+// ASCII case insensitive `contains`, uses the same lookup as `name_lookup<E>`
+template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
+[[nodiscard]] constexpr bool contains_icase(const string_view name) noexcept
+{
+  return details::icase_name_to_index<E>(name) != count<E>;
+}
+
 template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E), typename BinaryPred>
 [[nodiscard]] constexpr bool contains(const string_view name, const BinaryPred binary_pred) noexcept
 {
@@ -148,6 +198,10 @@ namespace details {
             details::countr_zero(static_cast<U>(values_generator<E>[has_zero]));
         }
       }
+      else if constexpr (index_layout<E> == index_layout_mode::rank_bitmap) {
+        if (const auto i = details::rank_bitmap_index<E>(static_cast<T>(e)); i != count<E>)
+          return optional<std::size_t>(i);
+      }
       else {
         for (std::size_t i = 0; i < count<E>; ++i) {
           if (values_generator<E>[i] == e)
@@ -170,15 +224,8 @@ namespace details {
 
     [[nodiscard]] constexpr optional<E> operator()(const string_view name) const noexcept
     {
-      constexpr auto minmax = details::minmax_string_size(names<E>.data(), names<E>.data() + names<E>.size());
-      if (const auto size = name.size(); size < minmax.first || size > minmax.second)
-        return optional<E>(); // nullopt
-
-      for (std::size_t i = 0; i < count<E>; ++i) {
-        if (names_generator<E>[i] == name) {
-          return optional<E>(values_generator<E>[i]);
-        }
-      }
+      if (const auto i = details::name_to_index<E>(name); i != count<E>)
+        return optional<E>(values_generator<E>[i]);
       return optional<E>(); // nullopt
     }
 
@@ -205,15 +252,41 @@ inline constexpr details::enum_to_index_functor enum_to_index{};
 template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
 inline constexpr details::cast_functor<E> cast{};
 
+// ASCII case insensitive `cast`, uses the same lookup as `name_lookup<E>`
+template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
+[[nodiscard]] constexpr optional<E> cast_icase(const string_view name) noexcept
+{
+  if (const auto i = details::icase_name_to_index<E>(name); i != count<E>)
+    return optional<E>(values_generator<E>[i]);
+  return optional<E>();
+}
+
 
 namespace details {
+  // a chain of comparisons against constants which compilers turn into a jump table or a binary search like a `switch`
+  template<typename E, std::size_t... I>
+  constexpr string_view switch_to_string(const E value, std::index_sequence<I...>) noexcept
+  {
+    using T      = std::underlying_type_t<E>;
+    const auto v = static_cast<T>(value);
+
+    string_view ret;
+    (void)((v == static_cast<T>(values<E>[I]) ? (ret = names<E>[I], true) : false) || ...);
+    return ret;
+  }
+
   struct to_string_functor {
     template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
     [[nodiscard]] constexpr string_view operator()(const E value) const noexcept
     {
-      if (const auto i = enchantum::enum_to_index(value))
-        return names_generator<E>[*i];
-      return string_view();
+      if constexpr (to_string_lookup<E> == to_string_lookup_mode::switch_case) {
+        return details::switch_to_string(value, std::make_index_sequence<count<E>>{});
+      }
+      else {
+        if (const auto i = enchantum::enum_to_index(value))
+          return names_generator<E>[*i];
+        return string_view();
+      }
     }
   };
 
@@ -16,6 +16,7 @@
 #endif
 
 #include "common.hpp"
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
@@ -25,6 +26,10 @@
 #if ENCHANTUM_CHECK_OUT_OF_BOUNDS_BY < 0
   #error ENCHANTUM_CHECK_OUT_OF_BOUNDS_BY must not be a negative number.
 #endif
+
+#ifndef ENCHANTUM_RANK_BITMAP_MAX_RANGE
+  #define ENCHANTUM_RANK_BITMAP_MAX_RANGE 4096
+#endif
 namespace enchantum {
 
 #ifdef __cpp_lib_to_underlying
@@ -172,6 +177,30 @@ namespace details {
 
   template<typename E, bool NullTerminated>
   inline constexpr auto reflection_string_indices = reflection_data<E, NullTerminated>.string_indices;
+
+  constexpr char ascii_to_lower(const char c) noexcept
+  {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+  }
+
+  // `reflection_data_string_storage` with ASCII letters lowercased, used by the case insensitive lookups
+  template<typename E>
+  inline constexpr auto reflection_data_lowercase_string_storage = [] {
+    auto strings = reflection_data_string_storage<E, true>;
+    for (auto& c : strings)
+      c = details::ascii_to_lower(c);
+    return strings;
+  }();
+
+  // null terminated name storage indexed by `reflection_string_indices<E, true>`
+  template<typename E, bool Lowercase>
+  constexpr const char* name_strings() noexcept
+  {
+    if constexpr (Lowercase)
+      return reflection_data_lowercase_string_storage<E>.data();
+    else
+      return reflection_data_string_storage<E, true>.data();
+  }
 } // namespace details
 
 #ifdef __cpp_concepts
@@ -234,6 +263,34 @@ namespace details {
     return ret;
   }
 
+  template<typename E>
+  constexpr auto get_lowercase_names() noexcept
+  {
+    constexpr auto& indices = reflection_string_indices<E, true>;
+    const auto*     strings = reflection_data_lowercase_string_storage<E>.data();
+
+    std::array<string_view, indices.size() - 1> ret{};
+    for (std::size_t i = 0; i < ret.size(); ++i)
+      ret[i] = string_view(strings + indices[i], indices[i + 1] - indices[i] - 1);
+    return ret;
+  }
+
+  template<typename E>
+  inline constexpr auto lowercase_names = details::get_lowercase_names<E>();
+
+  constexpr std::pair<std::size_t, std::size_t> minmax_string_size(const string_view* begin, const string_view* const end)
+  {
+    using T     = std::size_t;
+    auto minmax = std::pair<T, T>(std::numeric_limits<T>::max(), 0);
+
+    for (; begin != end; ++begin) {
+      const auto size = begin->size();
+      minmax.first    = minmax.first < size ? minmax.first : size;
+      minmax.second   = minmax.second > size ? minmax.second : size;
+    }
+    return minmax;
+  }
+
 } // namespace details
 
 template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
@@ -288,6 +345,32 @@ inline constexpr bool is_contiguous_bitflag = [](const auto is_bitflag) {
   }
 }(std::bool_constant<is_bitflag<E>>{});
 
+namespace details {
+  // `value - min<E>` computed in a type wide enough to never overflow
+  template<typename E>
+  constexpr std::uintmax_t offset_from_min(const std::underlying_type_t<E> value) noexcept
+  {
+    using Wide = std::conditional_t<std::is_signed_v<std::underlying_type_t<E>>, std::intmax_t, std::uintmax_t>;
+    return static_cast<std::uintmax_t>(static_cast<Wide>(value)) -
+      static_cast<std::uintmax_t>(static_cast<Wide>(enchantum::to_underlying(min<E>)));
+  }
+} // namespace details
+
+enum class index_layout_mode : unsigned char {
+  contiguous,
+  contiguous_bitflag,
+  rank_bitmap,
+  linear,
+};
+
+// how `enum_to_index` and `contains` map a value to its index
+template<typename E>
+inline constexpr index_layout_mode index_layout = is_contiguous<E> ? index_layout_mode::contiguous
+  : is_contiguous_bitflag<E>                                       ? index_layout_mode::contiguous_bitflag
+  : details::offset_from_min<E>(enchantum::to_underlying(max<E>)) < ENCHANTUM_RANK_BITMAP_MAX_RANGE
+  ? index_layout_mode::rank_bitmap
+  : index_layout_mode::linear;
+
 #ifdef __cpp_concepts
 template<typename E>
 concept ContiguousEnum = Enum<E> && is_contiguous<E>;
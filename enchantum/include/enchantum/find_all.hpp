@@ -0,0 +1,138 @@
+#pragma once
+#include "details/string_view.hpp"
+#include "enchantum.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace enchantum {
+namespace details {
+
+  // every byte which appears in a name gets a class starting from 1, the others are 0 and lead back to the root
+  template<typename E>
+  constexpr auto make_name_byte_classes() noexcept
+  {
+    const auto* const strings = details::name_strings<E, false>();
+    const auto* const indices = details::reflection_string_indices<E, true>.data();
+
+    std::array<std::uint8_t, 256> ret{};
+    std::uint8_t                  classes = 0;
+    for (std::size_t i = 0; i < count<E>; ++i)
+      for (auto c = indices[i]; c != indices[i + 1] - 1; ++c)
+        if (auto& cls = ret[static_cast<unsigned char>(strings[c])]; cls == 0)
+          cls = ++classes;
+    return ret;
+  }
+
+  template<typename E>
+  inline constexpr auto name_byte_classes = details::make_name_byte_classes<E>();
+
+  template<typename E>
+  inline constexpr std::size_t name_byte_class_count = [] {
+    std::size_t ret = 0;
+    for (const auto cls : name_byte_classes<E>)
+      ret = ret < cls ? cls : ret;
+    return ret + 1;
+  }();
+
+  // a state for every byte of every name and the root
+  template<typename E>
+  inline constexpr std::size_t name_automaton_states = [] {
+    const auto* const indices = details::reflection_string_indices<E, true>.data();
+    return static_cast<std::size_t>(indices[count<E>]) - count<E> + 1;
+  }();
+
+  // Aho-Corasick automaton of the names of `E` as a full transition table so searching is one lookup per byte
+  template<std::size_t States, std::size_t Classes>
+  struct NameAutomaton {
+    static_assert(States <= UINT16_MAX, "enchantum::find_all: the names of this enum are too long");
+
+    std::array<std::uint16_t, States * Classes> next{};
+    std::array<std::uint16_t, States>           matches{}; // the name ending at a state, `count<E>` for none
+    std::array<std::uint16_t, States>           links{};   // the longest proper suffix state with a match, 0 for none
+  };
+
+  template<typename E>
+  constexpr auto make_name_automaton() noexcept
+  {
+    constexpr std::size_t States  = name_automaton_states<E>;
+    constexpr std::size_t Classes = name_byte_class_count<E>;
+    static_assert(count<E> < UINT16_MAX, "");
+
+    const auto* const strings = details::name_strings<E, false>();
+    const auto* const indices = details::reflection_string_indices<E, true>.data();
+    const auto&       classes = name_byte_classes<E>;
+
+    NameAutomaton<States, Classes> ret{};
+    for (auto& m : ret.matches)
+      m = static_cast<std::uint16_t>(count<E>);
+
+    // the trie, no state has the root as a child so 0 is no child
+    std::size_t states = 1;
+    for (std::size_t i = 0; i < count<E>; ++i) {
+      std::size_t state = 0;
+      for (auto c = indices[i]; c != indices[i + 1] - 1; ++c) {
+        auto& child = ret.next[state * Classes + classes[static_cast<unsigned char>(strings[c])]];
+        if (child == 0)
+          child = static_cast<std::uint16_t>(states++);
+        state = child;
+      }
+      ret.matches[state] = static_cast<std::uint16_t>(i);
+    }
+
+    // breadth first so the failure state of every state is complete before its own row is filled in
+    std::array<std::uint16_t, States> fails{};
+    std::array<std::uint16_t, States> queue{};
+    std::size_t                       head = 0;
+    std::size_t                       tail = 0;
+    queue[tail++]                          = 0;
+    while (head != tail) {
+      const std::size_t state = queue[head++];
+      for (std::size_t cls = 0; cls < Classes; ++cls) {
+        auto&      next    = ret.next[state * Classes + cls];
+        const auto through = state == 0 ? std::uint16_t{0} : ret.next[fails[state] * Classes + cls];
+        if (next == 0) {
+          next = through;
+          continue;
+        }
+        fails[next]     = through;
+        ret.links[next] = ret.matches[through] != count<E> ? through : ret.links[through];
+        queue[tail++]   = next;
+      }
+    }
+    return ret;
+  }
+
+  template<typename E>
+  inline constexpr auto name_automaton = details::make_name_automaton<E>();
+
+} // namespace details
+
+// calls `f(offset, value)` for every occurrence of a name of `E` in `text` in one pass and gives how many there were.
+// Occurrences inside longer names or words are found as well, they come in the order they end in and the longer
+// name first when several end at the same byte
+template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E), typename Func>
+constexpr std::size_t find_all(const string_view text, Func f)
+{
+  constexpr std::size_t Classes   = details::name_byte_class_count<E>;
+  const auto&           automaton = details::name_automaton<E>;
+  const auto&           classes   = details::name_byte_classes<E>;
+  const auto* const     indices   = details::reflection_string_indices<E, true>.data();
+
+  const auto* const data  = text.data();
+  std::size_t       found = 0;
+  std::size_t       state = 0;
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    state = automaton.next[state * Classes + classes[static_cast<unsigned char>(data[i])]];
+    std::size_t s = automaton.matches[state] != count<E> ? state : automaton.links[state];
+    for (; s != 0; s = automaton.links[s]) {
+      const std::size_t name = automaton.matches[s];
+      const auto        size = static_cast<std::size_t>(indices[name + 1] - indices[name] - 1);
+      f(i + 1 - size, values_generator<E>[name]);
+      ++found;
+    }
+  }
+  return found;
+}
+
+} // namespace enchantum
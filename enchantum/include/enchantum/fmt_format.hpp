@@ -13,9 +13,31 @@ template<typename E>
 struct fmt::formatter<E, char, std::enable_if_t<std::is_enum_v<E>>>
 #endif
 : fmt::formatter<string_view> {
+private:
+  enchantum::details::FormatSpec m_spec;
+public:
+  // `d`, `x`, `X`, `s` and `|c` modes are parsed here, every other spec is a string spec
+  template<typename ParseContext>
+  constexpr auto parse(ParseContext& ctx)
+  {
+    const auto end = enchantum::details::format_spec_end(ctx.begin(), ctx.end());
+    if (!enchantum::details::has_format_mode(ctx.begin(), end))
+      return fmt::formatter<string_view>::parse(ctx);
+    if (const auto error = enchantum::details::parse_format_spec<E>(ctx.begin(), end, m_spec))
+#if FMT_VERSION >= 110000
+      fmt::report_error(error);
+#else
+      fmt::detail::throw_format_error(error);
+#endif
+    return end;
+  }
+
   template<typename FmtContext>
   constexpr auto format(const E e, FmtContext& ctx) const
   {
-    return fmt::formatter<string_view>::format(enchantum::details::format(e), ctx);
+    if (m_spec.mode != enchantum::details::FormatMode::name)
+      return enchantum::details::format_to(ctx.out(), e, m_spec);
+    char buffer[enchantum::details::format_buffer_size<E>];
+    return fmt::formatter<string_view>::format(enchantum::details::format(e, buffer), ctx);
   }
 };
\ No newline at end of file
@@ -0,0 +1,191 @@
+#pragma once
+#include "array.hpp"
+#include "details/bit_width.hpp"
+#include "details/shard.hpp"
+#include "enchantum.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// fewer shards than `ENCHANTUM_COUNTER_SHARDS` since every shard holds about `count<E> * 4KiB` of buckets with the
+// default `SubBucketBits`. Threads share the shards round robin so with more threads than shards they contend again
+#ifndef ENCHANTUM_HISTOGRAM_SHARDS
+  #define ENCHANTUM_HISTOGRAM_SHARDS 4
+#endif
+
+namespace enchantum {
+
+// log linear buckets: samples below `2^SubBucketBits` get a bucket each, above that every power of two is split in
+// `2^SubBucketBits` equal buckets so a bucket is at most `1 / 2^SubBucketBits` of its values wide
+template<unsigned SubBucketBits = 3>
+class histogram_snapshot {
+  static_assert(SubBucketBits >= 1 && SubBucketBits <= 8, "");
+public:
+  static constexpr std::size_t sub_buckets  = std::size_t{1} << SubBucketBits;
+  static constexpr std::size_t bucket_count = (65 - SubBucketBits) * sub_buckets;
+
+  [[nodiscard]] static constexpr std::size_t bucket_index(const std::uint64_t sample) noexcept
+  {
+    if (sample < sub_buckets)
+      return static_cast<std::size_t>(sample);
+    const auto shift = static_cast<unsigned>(details::bit_width(sample)) - 1 - SubBucketBits;
+    return (shift + 1) * sub_buckets + static_cast<std::size_t>(sample >> shift) - sub_buckets;
+  }
+
+  // smallest sample of bucket `i`
+  [[nodiscard]] static constexpr std::uint64_t bucket_lower(const std::size_t i) noexcept
+  {
+    if (i < sub_buckets)
+      return i;
+    const auto shift = i / sub_buckets - 1;
+    return static_cast<std::uint64_t>(sub_buckets + i % sub_buckets) << shift;
+  }
+
+  // largest sample of bucket `i`
+  [[nodiscard]] static constexpr std::uint64_t bucket_upper(const std::size_t i) noexcept
+  {
+    if (i < sub_buckets)
+      return i;
+    return bucket_lower(i) + ((std::uint64_t{1} << (i / sub_buckets - 1)) - 1);
+  }
+
+  std::array<std::uint64_t, bucket_count> buckets{};
+  std::uint64_t                           total = 0;
+  std::uint64_t                           sum   = 0;
+
+  [[nodiscard]] constexpr std::uint64_t count() const noexcept { return total; }
+
+  [[nodiscard]] constexpr double mean() const noexcept
+  {
+    return total == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(total);
+  }
+
+  // largest sample of the bucket holding the `p`th percentile, `p` is in [0, 100]. 0 if there are no samples
+  [[nodiscard]] constexpr std::uint64_t percentile(const double p) const noexcept
+  {
+    if (total == 0)
+      return 0;
+    const auto    target = p <= 0 ? 1.0 : p >= 100 ? static_cast<double>(total) : p / 100 * static_cast<double>(total);
+    std::uint64_t seen   = 0;
+    for (std::size_t i = 0; i < bucket_count; ++i) {
+      seen += buckets[i];
+      if (buckets[i] != 0 && static_cast<double>(seen) >= target)
+        return bucket_upper(i);
+    }
+    return bucket_upper(bucket_count - 1);
+  }
+
+  constexpr histogram_snapshot& operator+=(const histogram_snapshot& other) noexcept
+  {
+    for (std::size_t i = 0; i < bucket_count; ++i)
+      buckets[i] += other.buckets[i];
+    total += other.total;
+    sum += other.sum;
+    return *this;
+  }
+};
+
+// a latency histogram per member of `E` split into `Shards` cache line aligned copies, threads are spread over the
+// copies round robin and record with relaxed atomics. Reads merge every shard.
+template<typename E, std::size_t Shards = ENCHANTUM_HISTOGRAM_SHARDS, unsigned SubBucketBits = 3>
+class histogram_array {
+  static_assert(std::is_enum_v<E>);
+  static_assert(Shards != 0, "enchantum::histogram_array requires at least one shard");
+public:
+  using snapshot_type = histogram_snapshot<SubBucketBits>;
+
+  static constexpr std::size_t shards = Shards;
+
+private:
+  struct Slot {
+    std::atomic<std::uint64_t> buckets[snapshot_type::bucket_count]{};
+    std::atomic<std::uint64_t> sum{0};
+  };
+
+  struct alignas(details::cache_line_size) Shard {
+    Slot slots[count<E> == 0 ? 1 : count<E>];
+  };
+
+  Shard m_shards[Shards];
+
+  void merge(const std::size_t index, snapshot_type& ret) const noexcept
+  {
+    ret = snapshot_type();
+    for (const auto& shard : m_shards) {
+      const auto& slot = shard.slots[index];
+      for (std::size_t b = 0; b < snapshot_type::bucket_count; ++b) {
+        const auto n = slot.buckets[b].load(std::memory_order_relaxed);
+        ret.buckets[b] += n;
+        ret.total += n;
+      }
+      ret.sum += slot.sum.load(std::memory_order_relaxed);
+    }
+  }
+
+public:
+  histogram_array() noexcept = default;
+
+  histogram_array(const histogram_array&)            = delete;
+  histogram_array& operator=(const histogram_array&) = delete;
+
+  // gives false and records nothing if `value` is not a member of `E`
+  bool record(const E value, const std::uint64_t sample) noexcept
+  {
+    const auto i = enchantum::enum_to_index(value);
+    if (!i)
+      return false;
+    auto& slot = m_shards[details::this_thread_shard(Shards)].slots[*i];
+    slot.buckets[snapshot_type::bucket_index(sample)].fetch_add(1, std::memory_order_relaxed);
+    slot.sum.fetch_add(sample, std::memory_order_relaxed);
+    return true;
+  }
+
+  // the merged histogram of `value`, empty if it is not a member of `E`
+  [[nodiscard]] snapshot_type snapshot(const E value) const noexcept
+  {
+    snapshot_type ret;
+    if (const auto i = enchantum::enum_to_index(value))
+      merge(*i, ret);
+    return ret;
+  }
+
+  // every histogram at once, this is `count<E>` snapshots of about 4KiB each on the stack. Prefer the overload
+  // filling `out` or `for_each` for large enums
+  [[nodiscard]] array<E, snapshot_type> snapshot() const noexcept
+  {
+    array<E, snapshot_type> ret;
+    snapshot(ret);
+    return ret;
+  }
+
+  void snapshot(array<E, snapshot_type>& out) const noexcept
+  {
+    for (std::size_t i = 0; i < count<E>; ++i)
+      merge(i, out[i]);
+  }
+
+  // calls `f(name, snapshot)` for every member of `E` in order with `names<E>` as the labels, only one snapshot is on
+  // the stack at a time
+  template<typename Func>
+  void for_each(Func f) const
+  {
+    snapshot_type merged;
+    for (std::size_t i = 0; i < count<E>; ++i) {
+      merge(i, merged);
+      f(names<E>[i], static_cast<const snapshot_type&>(merged));
+    }
+  }
+
+  void reset() noexcept
+  {
+    for (auto& shard : m_shards)
+      for (auto& slot : shard.slots) {
+        for (auto& b : slot.buckets)
+          b.store(0, std::memory_order_relaxed);
+        slot.sum.store(0, std::memory_order_relaxed);
+      }
+  }
+};
+
+} // namespace enchantum
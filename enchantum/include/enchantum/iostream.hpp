@@ -1,40 +1,101 @@
 #pragma once
 
 #include "bitflags.hpp"
-#include "details/format_util.hpp"
+#include "details/format_buffer.hpp"
 #include "enchantum.hpp"
-#include <iostream>
-#include <string>
+#include <cstddef>
+#include <istream>
+#include <locale>
+#include <ostream>
 
 namespace enchantum {
+namespace details {
+  // longest string `operator>>` can accept for `E`
+  template<typename E>
+  inline constexpr std::size_t max_input_length = [] {
+    if constexpr (is_bitflag<E>)
+      return max_bitflag_string_length<E>;
+    else
+      return details::minmax_string_size(names<E>.data(), names<E>.data() + names<E>.size()).second;
+  }();
+} // namespace details
+
 namespace iostream_operators {
   template<typename Traits, ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
   std::basic_ostream<char, Traits>& operator<<(std::basic_ostream<char, Traits>& os, const E e)
   {
-    return os << details::format(e);
+    char       buffer[details::format_buffer_size<E>];
+    const auto s = details::format(e, buffer);
+
+    // `write` ignores the width so it is padded here like a formatted string, `internal` pads on the left as well
+    const auto size    = static_cast<std::streamsize>(s.size());
+    const auto padding = os.width() > size ? os.width() - size : 0;
+    const bool left    = (os.flags() & std::ios_base::adjustfield) == std::ios_base::left;
+    const auto pad     = [&os](std::streamsize n) {
+      for (const auto fill = os.fill(); n != 0; --n)
+        os.put(fill);
+    };
+    os.width(0);
+    if (!left)
+      pad(padding);
+    os.write(s.data(), size);
+    if (left)
+      pad(padding);
+    return os;
   }
 
   template<typename Traits, ENCHANTUM_DETAILS_ENUM_CONCEPT(E)>
   auto operator>>(std::basic_istream<char, Traits>& is, E& value) -> decltype((value = E{}, is))
   // sfinae to check whether value is assignable
   {
-    std::basic_string<char, Traits> s;
-    is >> s;
-    if (!is)
+    const typename std::basic_istream<char, Traits>::sentry sentry(is);
+    if (!sentry)
       return is;
 
+    // one more character than the longest name to tell apart longer words which are never names. Like reading a
+    // std::string a word ends at whitespace of the stream's locale or after `width()` characters if it is set
+    constexpr std::size_t size  = details::max_input_length<E> + 1;
+    const auto&           ctype = std::use_facet<std::ctype<char>>(is.getloc());
+    const auto            width = is.width();
+    const auto            limit = width > 0 ? static_cast<std::size_t>(width) : static_cast<std::size_t>(-1);
+    char                  buffer[size];
+    std::size_t           n     = 0;
+    auto&                 buf   = *is.rdbuf();
+    auto                  state = std::ios_base::goodbit;
+    for (std::size_t read = 0; read != limit; ++read) {
+      const auto c = buf.sgetc();
+      if (Traits::eq_int_type(c, Traits::eof())) {
+        state |= std::ios_base::eofbit;
+        break;
+      }
+      const auto ch = Traits::to_char_type(c);
+      if (ctype.is(std::ctype_base::space, ch))
+        break;
+      if (n != size)
+        buffer[n++] = ch;
+      buf.sbumpc();
+    }
+    is.width(0);
+
+    if (n == 0 || n == size) {
+      is.setstate(state | std::ios_base::failbit);
+      return is;
+    }
+
+    const auto s = string_view(buffer, n);
     if constexpr (is_bitflag<E>) {
       if (const auto v = enchantum::cast_bitflag<E>(s))
         value = *v;
       else
-        is.setstate(std::ios_base::failbit);
+        state |= std::ios_base::failbit;
     }
     else {
       if (const auto v = enchantum::cast<E>(s))
         value = *v;
       else
-        is.setstate(std::ios_base::failbit);
+        state |= std::ios_base::failbit;
     }
+    is.setstate(state);
     return is;
   }
 } // namespace iostream_operators
@@ -0,0 +1,161 @@
+#pragma once
+#include "details/optional.hpp"
+#include "details/string_view.hpp"
+#include "enchantum.hpp"
+#include "entries.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace enchantum {
+namespace details {
+
+  // indices into `names<E>` ordered by name, bytes compare as unsigned and a prefix sorts before longer names
+  template<typename E>
+  constexpr auto make_sorted_name_indices() noexcept
+  {
+    static_assert(count<E> < UINT16_MAX, "");
+    const auto* const strings = details::name_strings<E, false>();
+    const auto* const indices = details::reflection_string_indices<E, true>.data();
+    const auto        less    = [strings, indices](const std::size_t a, const std::size_t b) {
+      const auto a_size = static_cast<std::size_t>(indices[a + 1] - indices[a] - 1);
+      const auto b_size = static_cast<std::size_t>(indices[b + 1] - indices[b] - 1);
+      for (std::size_t i = 0; i < a_size && i < b_size; ++i) {
+        const auto x = static_cast<unsigned char>(strings[indices[a] + i]);
+        const auto y = static_cast<unsigned char>(strings[indices[b] + i]);
+        if (x != y)
+          return x < y;
+      }
+      return a_size < b_size;
+    };
+
+    // bottom up merge sort, insertion sort is too slow at compile time for large enums
+    std::array<std::uint16_t, count<E> == 0 ? 1 : count<E>> ret{};
+    std::array<std::uint16_t, count<E> == 0 ? 1 : count<E>> buffer{};
+    for (std::size_t i = 0; i < count<E>; ++i)
+      ret[i] = static_cast<std::uint16_t>(i);
+    for (std::size_t width = 1; width < count<E>; width *= 2) {
+      for (std::size_t first = 0; first < count<E>; first += 2 * width) {
+        const auto  mid  = first + width < count<E> ? first + width : count<E>;
+        const auto  last = first + 2 * width < count<E> ? first + 2 * width : count<E>;
+        std::size_t l    = first;
+        std::size_t r    = mid;
+        std::size_t out  = first;
+        while (l != mid && r != last)
+          buffer[out++] = less(ret[r], ret[l]) ? ret[r++] : ret[l++];
+        while (l != mid)
+          buffer[out++] = ret[l++];
+        while (r != last)
+          buffer[out++] = ret[r++];
+      }
+      ret = buffer;
+    }
+    return ret;
+  }
+
+  template<typename E>
+  inline constexpr auto sorted_name_indices = details::make_sorted_name_indices<E>();
+
+} // namespace details
+
+enum class match_status : unsigned char {
+  partial, // the bytes so far start at least one name
+  match,   // the bytes so far are a name, longer names may still match
+  reject,  // no name starts with the bytes so far
+};
+
+// matches the bytes of a name fed in any number of chunks without copying them, the candidates are the range of
+// names sorted at compile time which start with the bytes so far and narrow down with every byte
+template<typename E>
+class name_matcher {
+  std::uint16_t m_first = 0;
+  std::uint16_t m_last  = static_cast<std::uint16_t>(count<E>);
+  std::size_t   m_size  = 0;
+
+  static constexpr std::size_t name_size(const std::size_t sorted) noexcept
+  {
+    const auto* const indices = details::reflection_string_indices<E, true>.data();
+    const auto        i       = details::sorted_name_indices<E>[sorted];
+    return static_cast<std::size_t>(indices[i + 1] - indices[i] - 1);
+  }
+
+  // -1 for the name which ends at `position`, only the first candidate can
+  static constexpr int byte_at(const std::size_t sorted, const std::size_t position) noexcept
+  {
+    if (position >= name_size(sorted))
+      return -1;
+    const auto* const indices = details::reflection_string_indices<E, true>.data();
+    const auto        i       = details::sorted_name_indices<E>[sorted];
+    return static_cast<unsigned char>(details::name_strings<E, false>()[indices[i] + position]);
+  }
+
+public:
+  constexpr name_matcher() noexcept = default;
+
+  constexpr match_status feed(const char c) noexcept
+  {
+    if (m_first == m_last)
+      return match_status::reject;
+    const int   key   = static_cast<unsigned char>(c);
+    std::size_t first = m_first;
+    std::size_t last  = m_last;
+    // the candidates share `m_size` bytes so the next byte is sorted, find where `key` starts then where it ends
+    for (std::size_t n = last - first; n != 0;) {
+      const auto half = n / 2;
+      if (byte_at(first + half, m_size) < key) {
+        first += half + 1;
+        n -= half + 1;
+      }
+      else
+        n = half;
+    }
+    std::size_t end = first;
+    for (std::size_t n = last - first; n != 0;) {
+      const auto half = n / 2;
+      if (byte_at(end + half, m_size) <= key) {
+        end += half + 1;
+        n -= half + 1;
+      }
+      else
+        n = half;
+    }
+    m_first = static_cast<std::uint16_t>(first);
+    m_last  = static_cast<std::uint16_t>(end);
+    ++m_size;
+    return status();
+  }
+
+  // stops at the first byte which rejects every name
+  constexpr match_status feed(const string_view chunk) noexcept
+  {
+    const auto* const data = chunk.data();
+    for (std::size_t i = 0; i < chunk.size() && m_first != m_last; ++i)
+      feed(data[i]);
+    return status();
+  }
+
+  [[nodiscard]] constexpr match_status status() const noexcept
+  {
+    if (m_first == m_last)
+      return match_status::reject;
+    return name_size(m_first) == m_size ? match_status::match : match_status::partial;
+  }
+
+  // the name which the bytes so far are, if any
+  [[nodiscard]] constexpr optional<E> value() const noexcept
+  {
+    if (status() != match_status::match)
+      return optional<E>();
+    return values_generator<E>[details::sorted_name_indices<E>[m_first]];
+  }
+
+  // how many names start with the bytes so far
+  [[nodiscard]] constexpr std::size_t candidates() const noexcept { return std::size_t{m_last} - m_first; }
+
+  // how many bytes were fed
+  [[nodiscard]] constexpr std::size_t size() const noexcept { return m_size; }
+
+  constexpr void reset() noexcept { *this = name_matcher(); }
+};
+
+} // namespace enchantum
@@ -0,0 +1,301 @@
+#pragma once
+#include "array.hpp"
+#include "details/string_view.hpp"
+#include "enchantum.hpp"
+#include "histogram_array.hpp"
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace enchantum {
+
+// what `# TYPE` line `write_openmetrics` writes for plain values
+enum class metric_type : unsigned char {
+  gauge,
+  counter // the family is `metric` without a `_total` suffix and the samples are `metric_total`
+};
+
+// whether `write_openmetrics` ends the exposition with `# EOF`
+enum class metrics_end : unsigned char {
+  eof, // the output is a whole exposition
+  more // more metric families follow, pass `eof` for the last one only
+};
+
+namespace details {
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  inline constexpr bool has_float_to_chars = true;
+#else
+  // libstdc++ before GCC 11 only has integral `std::to_chars`
+  inline constexpr bool has_float_to_chars = false;
+#endif
+
+  template<std::size_t Count, std::size_t Chars>
+  struct LabelFragments {
+    // fragment `i` is [offsets[i], offsets[i + 1]) of `chars`
+    std::array<std::uint32_t, Count + 1>     offsets{};
+    std::array<char, Chars == 0 ? 1 : Chars> chars{};
+
+    constexpr string_view operator[](const std::size_t i) const noexcept
+    {
+      return string_view(chars.data() + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+  };
+
+  // writes `="name"` with `\`, `"` and newlines escaped as the exposition format requires.
+  // Only counts the characters if `out` is null
+  constexpr std::size_t render_label_fragment(const string_view name, char* const out) noexcept
+  {
+    std::size_t size = 0;
+    const auto  put  = [out, &size](const char c) {
+      if (out)
+        out[size] = c;
+      ++size;
+    };
+    put('=');
+    put('"');
+    for (std::size_t i = 0; i < name.size(); ++i) {
+      const char c = name.data()[i];
+      if (c == '\\' || c == '"')
+        put('\\');
+      if (c == '\n') {
+        put('\\');
+        put('n');
+      }
+      else
+        put(c);
+    }
+    put('"');
+    return size;
+  }
+
+  template<typename E>
+  constexpr auto make_label_fragments() noexcept
+  {
+    constexpr std::size_t chars = [] {
+      std::size_t ret = 0;
+      for (std::size_t i = 0; i < count<E>; ++i)
+        ret += details::render_label_fragment(names<E>[i], nullptr);
+      return ret;
+    }();
+
+    LabelFragments<count<E>, chars> ret{};
+    std::size_t                     offset = 0;
+    for (std::size_t i = 0; i < count<E>; ++i) {
+      ret.offsets[i] = static_cast<std::uint32_t>(offset);
+      offset += details::render_label_fragment(names<E>[i], ret.chars.data() + offset);
+    }
+    ret.offsets[count<E>] = static_cast<std::uint32_t>(offset);
+    return ret;
+  }
+
+  // `="name"` for every member of `E`
+  template<typename E>
+  inline constexpr auto label_fragments = details::make_label_fragments<E>();
+
+  class MetricsWriter {
+    char*       m_first;
+    char* const m_last;
+  public:
+    MetricsWriter(char* const first, char* const last) noexcept : m_first(first), m_last(last) {}
+
+    char* ptr() const noexcept { return m_first; }
+
+    bool append(const string_view s) noexcept
+    {
+      if (static_cast<std::size_t>(m_last - m_first) < s.size())
+        return false;
+      if (s.size() != 0)
+        std::memcpy(m_first, s.data(), s.size());
+      m_first += s.size();
+      return true;
+    }
+
+    bool append(const char c) noexcept
+    {
+      if (m_first == m_last)
+        return false;
+      *m_first++ = c;
+      return true;
+    }
+
+    template<typename Number>
+    bool append_number(const Number n) noexcept
+    {
+      if constexpr (std::is_floating_point_v<Number>) {
+        if (n != n)
+          return append(string_view("NaN", 3));
+        if (n == std::numeric_limits<Number>::infinity())
+          return append(string_view("+Inf", 4));
+        if (n == -std::numeric_limits<Number>::infinity())
+          return append(string_view("-Inf", 4));
+      }
+      if constexpr (std::is_integral_v<Number> || has_float_to_chars) {
+        const auto [ptr, ec] = std::to_chars(m_first, m_last, n);
+        m_first              = ptr;
+        return ec == std::errc{};
+      }
+      else
+        return false;
+    }
+
+    // `# TYPE family type\n`
+    bool append_type(const string_view family, const string_view type) noexcept
+    {
+      return append(string_view("# TYPE ", 7)) && append(family) && append(' ') && append(type) && append('\n');
+    }
+
+    bool append_end(const metrics_end end) noexcept
+    {
+      return end == metrics_end::more || append(string_view("# EOF\n", 6));
+    }
+
+    // `metric_suffix{label="name"`
+    bool append_series(const string_view metric,
+                       const string_view suffix,
+                       const string_view label,
+                       const string_view fragment) noexcept
+    {
+      return append(metric) && append(suffix) && append('{') && append(label) && append(fragment);
+    }
+  };
+
+  // the largest sample of every bucket
+  template<unsigned SubBucketBits>
+  inline constexpr auto histogram_bucket_bounds = [] {
+    using snapshot_type = histogram_snapshot<SubBucketBits>;
+    std::array<std::uint64_t, snapshot_type::bucket_count> ret{};
+    for (std::size_t b = 0; b < ret.size(); ++b)
+      ret[b] = snapshot_type::bucket_upper(b);
+    return ret;
+  }();
+
+  template<typename E, unsigned SubBucketBits, typename Container>
+  std::to_chars_result write_openmetrics_histograms(
+    char* const                                                   first,
+    char* const                                                   last,
+    const string_view                                             metric,
+    const string_view                                             label,
+    const array<E, histogram_snapshot<SubBucketBits>, Container>& values,
+    const std::uint64_t* const                                    bounds,
+    const std::size_t                                             bound_count,
+    const metrics_end                                             end) noexcept
+  {
+    using snapshot_type       = histogram_snapshot<SubBucketBits>;
+    constexpr auto& fragments = details::label_fragments<E>;
+    details::MetricsWriter out(first, last);
+
+    const auto series = [&](const string_view suffix, const std::size_t i) {
+      return out.append_series(metric, suffix, label, fragments[i]);
+    };
+
+    if (!out.append_type(metric, string_view("histogram", 9)))
+      return {last, std::errc::value_too_large};
+    for (std::size_t i = 0; i < count<E>; ++i) {
+      const auto&   h          = values[i];
+      std::uint64_t cumulative = 0;
+      std::size_t   b          = 0;
+      for (std::size_t k = 0; k < bound_count; ++k) {
+        // a bucket only counts once all of it is at most the bound
+        for (; b < snapshot_type::bucket_count && snapshot_type::bucket_upper(b) <= bounds[k]; ++b)
+          cumulative += h.buckets[b];
+        if (!(series(string_view("_bucket", 7), i) && out.append(string_view(",le=\"", 5)) &&
+              out.append_number(bounds[k]) && out.append(string_view("\"} ", 3)) && out.append_number(cumulative) &&
+              out.append('\n')))
+          return {last, std::errc::value_too_large};
+      }
+      if (!(series(string_view("_bucket", 7), i) && out.append(string_view(",le=\"+Inf\"} ", 12)) &&
+            out.append_number(h.total) && out.append('\n') && series(string_view("_sum", 4), i) &&
+            out.append(string_view("} ", 2)) && out.append_number(h.sum) && out.append('\n') &&
+            series(string_view("_count", 6), i) && out.append(string_view("} ", 2)) && out.append_number(h.total) &&
+            out.append('\n')))
+        return {last, std::errc::value_too_large};
+    }
+    if (!out.append_end(end))
+      return {last, std::errc::value_too_large};
+    return {out.ptr(), std::errc{}};
+  }
+
+} // namespace details
+
+// writes a `# TYPE` line and a `metric{label="Name"} value` line for every member of `E` into [first, last) without
+// allocating, the `="Name"` parts are built at compile time from `names<E>`. `# HELP` and `# UNIT` lines go before it.
+// gives {end of the output, errc{}} or {last, errc::value_too_large} if it does not fit
+template<typename E, typename Number, typename Container>
+[[nodiscard]] std::to_chars_result write_openmetrics(char* const                        first,
+                                                     char* const                        last,
+                                                     const string_view                  metric,
+                                                     const string_view                  label,
+                                                     const array<E, Number, Container>& values,
+                                                     const metric_type                  type = metric_type::gauge,
+                                                     const metrics_end                  end  = metrics_end::eof) noexcept
+{
+  static_assert(std::is_arithmetic_v<Number> && !std::is_same_v<Number, bool>,
+                "enchantum::write_openmetrics requires numeric values");
+  static_assert(std::is_integral_v<Number> || details::has_float_to_chars,
+                "enchantum::write_openmetrics needs a standard library with floating point std::to_chars for "
+                "floating point values");
+  constexpr auto&        fragments = details::label_fragments<E>;
+  constexpr string_view  total("_total", 6);
+  details::MetricsWriter out(first, last);
+
+  auto family = metric;
+  if (type == metric_type::counter && family.size() >= total.size() &&
+      std::memcmp(family.data() + family.size() - total.size(), total.data(), total.size()) == 0)
+    family = string_view(family.data(), family.size() - total.size());
+  const auto suffix = type == metric_type::counter ? total : string_view();
+
+  if (!out.append_type(family, type == metric_type::counter ? string_view("counter", 7) : string_view("gauge", 5)))
+    return {last, std::errc::value_too_large};
+  for (std::size_t i = 0; i < count<E>; ++i) {
+    if (!(out.append_series(family, suffix, label, fragments[i]) && out.append(string_view("} ", 2)) &&
+          out.append_number(values[i]) && out.append('\n')))
+      return {last, std::errc::value_too_large};
+  }
+  if (!out.append_end(end))
+    return {last, std::errc::value_too_large};
+  return {out.ptr(), std::errc{}};
+}
+
+// writes the `# TYPE` line and the `metric_bucket`, `metric_sum` and `metric_count` series of every member of `E`.
+// Every member gets a cumulative `le` line for the largest sample of every bucket and `+Inf`, so the series are the
+// same on every scrape
+template<typename E, unsigned SubBucketBits, typename Container>
+[[nodiscard]] std::to_chars_result write_openmetrics(
+  char* const                                                   first,
+  char* const                                                   last,
+  const string_view                                             metric,
+  const string_view                                             label,
+  const array<E, histogram_snapshot<SubBucketBits>, Container>& values,
+  const metrics_end                                             end = metrics_end::eof) noexcept
+{
+  constexpr auto& bounds = details::histogram_bucket_bounds<SubBucketBits>;
+  return details::write_openmetrics_histograms(first, last, metric, label, values, bounds.data(), bounds.size(), end);
+}
+
+// same as above with a `le` line for every bound of the ascending `bounds` instead.
+// A bound counts the buckets whose largest sample is at most it, so bounds between them count slightly less
+template<typename E, unsigned SubBucketBits, typename Container, typename Bounds>
+[[nodiscard]] std::to_chars_result write_openmetrics(
+  char* const                                                   first,
+  char* const                                                   last,
+  const string_view                                             metric,
+  const string_view                                             label,
+  const array<E, histogram_snapshot<SubBucketBits>, Container>& values,
+  const Bounds&                                                 bounds,
+  const metrics_end                                             end = metrics_end::eof) noexcept
+{
+  using bound_type = std::remove_cv_t<std::remove_pointer_t<decltype(std::data(bounds))>>;
+  static_assert(std::is_same_v<bound_type, std::uint64_t>,
+                "enchantum::write_openmetrics requires contiguous std::uint64_t bounds");
+  return details::write_openmetrics_histograms(first, last, metric, label, values, std::data(bounds),
+                                               std::size(bounds), end);
+}
+
+} // namespace enchantum
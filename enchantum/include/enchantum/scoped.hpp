@@ -87,27 +87,25 @@ namespace scoped {
   inline constexpr details::scoped_cast_functor<E> cast;
 
   template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename BinaryPred>
-  [[nodiscard]] constexpr bool contains_bitflag(const string_view s, const char sep, const BinaryPred binary_pred) noexcept
+  [[nodiscard]] constexpr bool contains_bitflag(const string_view    s,
+                                                const char           sep,
+                                                const BinaryPred     binary_pred,
+                                                const bitflag_spaces spaces = bitflag_spaces::reject) noexcept
   {
-    std::size_t pos = 0;
-    for (std::size_t i = s.find(sep); i != s.npos; i = s.find(sep, pos)) {
-      if (!enchantum::scoped::contains<E>(s.substr(pos, i - pos), binary_pred))
-        return false;
-      pos = i + 1;
-    }
-    return enchantum::scoped::contains<E>(s.substr(pos), binary_pred);
+    return enchantum::details::for_each_flag_token(s, sep, spaces, [binary_pred](const string_view token) {
+      return enchantum::scoped::contains<E>(token, binary_pred);
+    });
   }
 
   template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
-  [[nodiscard]] constexpr bool contains_bitflag(const string_view s, const char sep = '|') noexcept
+  [[nodiscard]] constexpr bool contains_bitflag(const string_view    s,
+                                                const char           sep    = '|',
+                                                const bitflag_spaces spaces = bitflag_spaces::reject) noexcept
   {
-    std::size_t pos = 0;
-    for (std::size_t i = s.find(sep); i != s.npos; i = s.find(sep, pos)) {
-      if (!enchantum::scoped::contains<E>(s.substr(pos, i - pos)))
-        return false;
-      pos = i + 1;
-    }
-    return enchantum::scoped::contains<E>(s.substr(pos));
+    return enchantum::details::for_each_flag_token(s, sep, spaces, [](const string_view token) {
+      const auto n = details::remove_scope_or_empty(token, type_name<E>);
+      return !n.empty() && enchantum::details::name_to_index<E>(n) != count<E>;
+    });
   }
 
 
@@ -119,50 +117,56 @@ namespace scoped {
       if (static_cast<T>(value) == 0)
         return enchantum::scoped::to_string(value);
 
-    String         name;
-    T              check_value = 0;
-    constexpr auto scope_name  = type_name<E>;
-    for (auto i = std::size_t{has_zero_flag<E>}; i < count<E>; ++i) {
-      const auto v = static_cast<T>(values_generator<E>[i]);
-      if (v == (static_cast<T>(value) & v)) {
-        if (!name.empty())
-          name.append(1, sep); // append separator if not the first value
-        name.append(scope_name.data(), scope_name.size());
-        name.append("::", 2);
-        const auto s = names_generator<E>[i];
-        name.append(s.data(), s.size()); // not using operator += since this may not be std::string_view always
-        check_value |= v;
-      }
-    }
-    if (check_value == static_cast<T>(value))
+    String     name;
+    const bool valid = enchantum::details::for_each_flag_index<E>(static_cast<T>(value), [&name, sep](const std::size_t i) {
+      constexpr auto scope_name = type_name<E>;
+      if (!name.empty())
+        name.append(1, sep); // append separator if not the first value
+      name.append(scope_name.data(), scope_name.size());
+      name.append("::", 2);
+      const auto s = names_generator<E>[i];
+      name.append(s.data(), s.size()); // not using operator += since this may not be std::string_view always
+    });
+    if (valid)
       return name;
     return string();
   }
 
 
   template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E), typename BinaryPred>
-  [[nodiscard]] constexpr optional<E> cast_bitflag(const string_view s, const char sep, const BinaryPred binary_pred) noexcept
+  [[nodiscard]] constexpr optional<E> cast_bitflag(const string_view    s,
+                                                   const char           sep,
+                                                   const BinaryPred     binary_pred,
+                                                   const bitflag_spaces spaces = bitflag_spaces::reject) noexcept
   {
     using T = std::underlying_type_t<E>;
-    T           check_value{};
-    std::size_t pos = 0;
-    for (std::size_t i = s.find(sep); i != s.npos; i = s.find(sep, pos)) {
-      if (const auto v = enchantum::scoped::cast<E>(s.substr(pos, i - pos), binary_pred))
+    T          check_value{};
+    const auto add_flag = [&check_value, binary_pred](const string_view token) {
+      const auto v = enchantum::scoped::cast<E>(token, binary_pred);
+      if (v)
         check_value |= static_cast<T>(*v);
-      else
-        return optional<E>();
-      pos = i + 1;
-    }
-
-    if (const auto v = enchantum::scoped::cast<E>(s.substr(pos), binary_pred))
-      return optional<E>(static_cast<E>(check_value | static_cast<T>(*v)));
-    return optional<E>();
+      return bool(v);
+    };
+    const bool valid = enchantum::details::for_each_flag_token(s, sep, spaces, add_flag);
+    return valid ? optional<E>(static_cast<E>(check_value)) : optional<E>();
   }
 
   template<ENCHANTUM_DETAILS_ENUM_BITFLAG_CONCEPT(E)>
-  [[nodiscard]] constexpr optional<E> cast_bitflag(const string_view s, const char sep = '|') noexcept
+  [[nodiscard]] constexpr optional<E> cast_bitflag(const string_view    s,
+                                                   const char           sep    = '|',
+                                                   const bitflag_spaces spaces = bitflag_spaces::reject) noexcept
   {
-    return enchantum::scoped::cast_bitflag<E>(s, sep, [](const auto& a, const auto& b) { return a == b; });
+    using T = std::underlying_type_t<E>;
+    T          check_value{};
+    const bool valid = enchantum::details::for_each_flag_token(s, sep, spaces, [&check_value](const string_view token) {
+      const auto n = details::remove_scope_or_empty(token, type_name<E>);
+      const auto i = n.empty() ? count<E> : enchantum::details::name_to_index<E>(n);
+      if (i == count<E>)
+        return false;
+      check_value |= static_cast<T>(values_generator<E>[i]);
+      return true;
+    });
+    return valid ? optional<E>(static_cast<E>(check_value)) : optional<E>();
   }
 } // namespace scoped
 } // namespace enchantum
@@ -0,0 +1,179 @@
+#pragma once
+#include "details/bit_width.hpp"
+#include "details/optional.hpp"
+#include "details/shard.hpp"
+#include "details/string_view.hpp"
+#include "enchantum.hpp"
+#include "type_name.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#ifndef ENCHANTUM_TRACE_CAPACITY
+  #define ENCHANTUM_TRACE_CAPACITY 4096
+#endif
+
+namespace enchantum {
+
+// gives every enum of `Es` a type id, the record of a member is its type id in the high bits and its
+// `enum_to_index` in the low bits packed in 1 byte if it fits and 2 bytes otherwise.
+// Decoding only needs the same list of enums so records can be decoded later or by another process
+template<typename... Es>
+class trace_schema {
+  static_assert(sizeof...(Es) != 0, "enchantum::trace_schema requires at least one enum");
+  static_assert((std::is_enum_v<Es> && ...));
+
+  static constexpr std::size_t max_count = [] {
+    std::size_t ret = 1;
+    ((ret = ret < count<Es> ? count<Es> : ret), ...);
+    return ret;
+  }();
+
+  template<typename E>
+  static constexpr std::size_t find_type_id() noexcept
+  {
+    std::size_t ret = 0;
+    (void)((std::is_same_v<E, Es> ? true : (++ret, false)) || ...);
+    return ret;
+  }
+
+public:
+  static constexpr std::size_t type_count = sizeof...(Es);
+  static constexpr unsigned    index_bits = static_cast<unsigned>(details::bit_width(max_count - 1));
+  static constexpr unsigned    type_bits  = static_cast<unsigned>(details::bit_width(type_count - 1));
+  static_assert(index_bits + type_bits <= 16, "enchantum::trace_schema records do not fit in 2 bytes");
+
+  using record_type = std::conditional_t<index_bits + type_bits <= 8, std::uint8_t, std::uint16_t>;
+
+  template<typename E>
+  static constexpr std::size_t type_id = find_type_id<E>();
+
+  // gives nothing if `value` is not a member of `E`
+  template<typename E>
+  [[nodiscard]] static constexpr optional<record_type> encode(const E value) noexcept
+  {
+    static_assert(type_id<E> != type_count, "enchantum::trace_schema does not contain this enum");
+    if (const auto i = enchantum::enum_to_index(value))
+      return static_cast<record_type>((type_id<E> << index_bits) | *i);
+    return optional<record_type>();
+  }
+
+  [[nodiscard]] static constexpr std::size_t type_id_of(const record_type record) noexcept
+  {
+    return static_cast<std::size_t>(record >> index_bits);
+  }
+
+  [[nodiscard]] static constexpr std::size_t index_of(const record_type record) noexcept
+  {
+    return static_cast<std::size_t>(record & ((1u << index_bits) - 1));
+  }
+
+  // these give an empty string for records not made by `encode`
+  [[nodiscard]] static constexpr string_view type_name_of(const record_type record) noexcept
+  {
+    constexpr string_view type_names[] = {type_name<Es>...};
+    const auto            id           = type_id_of(record);
+    return id < type_count ? type_names[id] : string_view();
+  }
+
+  [[nodiscard]] static constexpr string_view name_of(const record_type record) noexcept
+  {
+    constexpr const string_view* name_tables[] = {names<Es>.data()...};
+    constexpr std::size_t        counts[]      = {count<Es>...};
+
+    const auto id    = type_id_of(record);
+    const auto index = index_of(record);
+    return id < type_count && index < counts[id] ? name_tables[id][index] : string_view();
+  }
+
+  // calls `f(type_name, name)` for every record in [first, last)
+  template<typename Func>
+  static constexpr void decode(const record_type* first, const record_type* const last, Func f)
+  {
+    for (; first != last; ++first)
+      f(type_name_of(*first), name_of(*first));
+  }
+};
+
+// single producer single consumer ring of `Schema::record_type` records, meant to be owned by the thread writing
+// to it with a background thread draining it. The producer never blocks, records pushed while the ring is full are
+// dropped and counted
+template<typename Schema, std::size_t Capacity = ENCHANTUM_TRACE_CAPACITY>
+class trace_ring {
+  static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+                "enchantum::trace_ring capacity must be a power of 2");
+public:
+  using schema_type = Schema;
+  using record_type = typename Schema::record_type;
+
+  static constexpr std::size_t capacity = Capacity;
+
+private:
+  // written by the producer
+  alignas(details::cache_line_size) std::atomic<std::size_t> m_head{0};
+  std::atomic<std::size_t> m_dropped{0};
+  std::size_t              m_cached_tail = 0;
+
+  // written by the consumer
+  alignas(details::cache_line_size) std::atomic<std::size_t> m_tail{0};
+
+  alignas(details::cache_line_size) record_type m_records[Capacity]{};
+
+public:
+  trace_ring() noexcept = default;
+
+  trace_ring(const trace_ring&)            = delete;
+  trace_ring& operator=(const trace_ring&) = delete;
+
+  // producer only, gives false if the ring is full or `value` is not a member of `E`
+  template<typename E>
+  bool push(const E value) noexcept
+  {
+    const auto record = Schema::encode(value);
+    if (!record)
+      return false;
+
+    const auto head = m_head.load(std::memory_order_relaxed);
+    if (head - m_cached_tail == Capacity) {
+      m_cached_tail = m_tail.load(std::memory_order_acquire);
+      if (head - m_cached_tail == Capacity) {
+        m_dropped.store(m_dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+      }
+    }
+    m_records[head % Capacity] = *record;
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // consumer only, calls `f(record)` for every record pushed so far and gives how many there were
+  template<typename Func>
+  std::size_t consume(Func f)
+  {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    const auto head = m_head.load(std::memory_order_acquire);
+    for (auto i = tail; i != head; ++i)
+      f(m_records[i % Capacity]);
+    m_tail.store(head, std::memory_order_release);
+    return head - tail;
+  }
+
+  // consumer only, calls `f(type_name, name)` for every record pushed so far and gives how many there were
+  template<typename Func>
+  std::size_t consume_names(Func f)
+  {
+    return consume([&f](const record_type record) { f(Schema::type_name_of(record), Schema::name_of(record)); });
+  }
+
+  [[nodiscard]] std::size_t size() const noexcept
+  {
+    const auto tail = m_tail.load(std::memory_order_acquire);
+    return m_head.load(std::memory_order_acquire) - tail;
+  }
+
+  // records dropped because the ring was full
+  [[nodiscard]] std::size_t dropped() const noexcept { return m_dropped.load(std::memory_order_relaxed); }
+};
+
+} // namespace enchantum
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "bulk.hpp"
+#include "common.hpp"
+#include "details/countr_zero.hpp"
+#include "details/rank_bitmap.hpp"
+#include "details/simd.hpp"
+#include "enchantum.hpp"
+#include "entries.hpp"
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#if defined(ENCAHNTUM_DETAILS_GCC_MAJOR) && ENCAHNTUM_DETAILS_GCC_MAJOR <= 10
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wconversion"
+#endif
+
+namespace enchantum {
+namespace details {
+
+  // values checked per vector, 0 if only the scalar loop applies
+  template<typename E, typename Element>
+  constexpr std::size_t validate_lanes() noexcept
+  {
+    using T = std::underlying_type_t<E>;
+    if constexpr (sizeof(Element) != 4 || !(std::is_same_v<Element, T> || std::is_same_v<Element, E>)) {
+      return 0;
+    }
+    else if constexpr (index_layout<E> == index_layout_mode::contiguous ||
+                       index_layout<E> == index_layout_mode::contiguous_bitflag) {
+#if defined(__AVX2__)
+      return 8;
+#elif defined(ENCHANTUM_DETAILS_SSE2)
+      return 4;
+#else
+      return 0;
+#endif
+    }
+    else if constexpr (index_layout<E> == index_layout_mode::rank_bitmap) {
+#if defined(__AVX2__)
+      return 8;
+#else
+      return 0;
+#endif
+    }
+    else {
+      return 0;
+    }
+  }
+
+  template<typename E>
+  inline constexpr std::int32_t validate_first = static_cast<std::int32_t>(
+    static_cast<std::uint32_t>(enchantum::to_underlying(min<E>)));
+
+  // `offset <= span` as unsigned is `(offset ^ INT32_MIN) <= (span ^ INT32_MIN)` as signed
+  template<typename E>
+  inline constexpr std::int32_t validate_biased_span = static_cast<std::int32_t>(
+    static_cast<std::uint32_t>(details::offset_from_min<E>(enchantum::to_underlying(max<E>))) ^ 0x80000000u);
+
+#if defined(__AVX2__)
+  template<typename E>
+  inline unsigned validate_mask_simd(const void* const p) noexcept
+  {
+    const auto v      = _mm256_loadu_si256(static_cast<const __m256i*>(p));
+    const auto offset = _mm256_sub_epi32(v, _mm256_set1_epi32(validate_first<E>));
+    const auto above  = _mm256_cmpgt_epi32(_mm256_xor_si256(offset, _mm256_set1_epi32(INT32_MIN)),
+                                          _mm256_set1_epi32(validate_biased_span<E>));
+    auto valid = _mm256_xor_si256(above, _mm256_set1_epi32(-1));
+
+    if constexpr (index_layout<E> == index_layout_mode::contiguous_bitflag) {
+      const auto zero = _mm256_setzero_si256();
+      valid = _mm256_and_si256(valid,
+                               _mm256_cmpeq_epi32(_mm256_and_si256(v, _mm256_sub_epi32(v, _mm256_set1_epi32(1))), zero));
+      if constexpr (!has_zero_flag<E>)
+        valid = _mm256_andnot_si256(_mm256_cmpeq_epi32(v, zero), valid);
+    }
+    else if constexpr (index_layout<E> == index_layout_mode::rank_bitmap) {
+      // out of range lanes gather word 0 and are masked off afterwards
+      const auto word_index = _mm256_and_si256(_mm256_srli_epi32(offset, 5), valid);
+      const auto words      = _mm256_i32gather_epi32(reinterpret_cast<const int*>(rank_bitmap<E>.bits.data()),
+                                                word_index,
+                                                4);
+      const auto bits = _mm256_srlv_epi32(words, _mm256_and_si256(offset, _mm256_set1_epi32(31)));
+      // only the sign bit is read by the movemask
+      valid = _mm256_and_si256(valid, _mm256_slli_epi32(bits, 31));
+    }
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(valid)));
+  }
+#elif defined(ENCHANTUM_DETAILS_SSE2)
+  template<typename E>
+  inline unsigned validate_mask_simd(const void* const p) noexcept
+  {
+    const auto v      = _mm_loadu_si128(static_cast<const __m128i*>(p));
+    const auto offset = _mm_sub_epi32(v, _mm_set1_epi32(validate_first<E>));
+    const auto above  = _mm_cmpgt_epi32(_mm_xor_si128(offset, _mm_set1_epi32(INT32_MIN)),
+                                       _mm_set1_epi32(validate_biased_span<E>));
+    auto valid = _mm_xor_si128(above, _mm_set1_epi32(-1));
+
+    if constexpr (index_layout<E> == index_layout_mode::contiguous_bitflag) {
+      const auto zero = _mm_setzero_si128();
+      valid = _mm_and_si128(valid, _mm_cmpeq_epi32(_mm_and_si128(v, _mm_sub_epi32(v, _mm_set1_epi32(1))), zero));
+      if constexpr (!has_zero_flag<E>)
+        valid = _mm_andnot_si128(_mm_cmpeq_epi32(v, zero), valid);
+    }
+    return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(valid)));
+  }
+#else
+  // never called, `validate_lanes` is 0 without SIMD
+  template<typename E>
+  unsigned validate_mask_simd(const void* p) noexcept;
+#endif
+
+} // namespace details
+
+// gives the index of the first value of `values` that is not a member of `E` or `std::size(values)` if all are
+template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E), typename Input>
+[[nodiscard]] constexpr std::size_t validate(const Input& values) noexcept
+{
+  using T       = std::underlying_type_t<E>;
+  using Element = details::range_value_t<const Input>;
+
+  const auto        size = static_cast<std::size_t>(std::size(values));
+  const auto* const in   = std::data(values);
+  std::size_t       i    = 0;
+
+  if constexpr (constexpr auto lanes = details::validate_lanes<E, Element>(); lanes != 0) {
+    if (!details::is_constant_evaluated()) {
+      constexpr unsigned all = (1u << lanes) - 1;
+      for (; i + lanes <= size; i += lanes)
+        if (const auto mask = details::validate_mask_simd<E>(in + i); mask != all)
+          return i + static_cast<std::size_t>(details::countr_zero(~mask));
+    }
+  }
+
+  for (; i < size; ++i)
+    if (!enchantum::contains<E>(static_cast<T>(in[i])))
+      return i;
+  return size;
+}
+
+// sets bit `i % 64` of `mask[i / 64]` if `values[i]` is a member of `E`, `mask` must hold `(std::size(values) + 63) / 64` words
+template<ENCHANTUM_DETAILS_ENUM_CONCEPT(E), typename Input, typename Output>
+constexpr void validate_mask(const Input& values, Output&& mask) noexcept
+{
+  using T       = std::underlying_type_t<E>;
+  using Element = details::range_value_t<const Input>;
+
+  const auto size  = static_cast<std::size_t>(std::size(values));
+  const auto words = (size + 63) / 64;
+  ENCHANTUM_ASSERT(static_cast<std::size_t>(std::size(mask)) >= words, "enchantum::validate_mask mask is too small", size);
+  const auto* const in  = std::data(values);
+  auto* const       out = std::data(mask);
+
+  for (std::size_t w = 0; w < words; ++w)
+    out[w] = 0;
+
+  std::size_t i = 0;
+  if constexpr (constexpr auto lanes = details::validate_lanes<E, Element>(); lanes != 0) {
+    // `lanes` divides 64 so a vector never straddles two words
+    if (!details::is_constant_evaluated())
+      for (; i + lanes <= size; i += lanes)
+        out[i / 64] |= std::uint64_t{details::validate_mask_simd<E>(in + i)} << (i % 64);
+  }
+
+  for (; i < size; ++i)
+    out[i / 64] |= std::uint64_t{enchantum::contains<E>(static_cast<T>(in[i]))} << (i % 64);
+}
+
+} // namespace enchantum
+
+#if defined(ENCAHNTUM_DETAILS_GCC_MAJOR) && ENCAHNTUM_DETAILS_GCC_MAJOR <= 10
+  #pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,115 @@
+#include "test_utility.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/atomic_bitset.hpp>
+#include <thread>
+#include <vector>
+
+namespace {
+enum class ConnectionState {
+  Open,
+  Authenticated,
+  Reading,
+  Writing,
+  Closing,
+};
+} // namespace
+
+TEST_CASE("atomic_bitset: set, reset, flip and test", "[atomic_bitset]")
+{
+  enchantum::atomic_bitset<ConnectionState> state{ConnectionState::Open};
+
+  CHECK(state.test(ConnectionState::Open));
+  CHECK_FALSE(state.test(ConnectionState::Reading));
+
+  CHECK_FALSE(state.set(ConnectionState::Reading));
+  CHECK(state.set(ConnectionState::Reading));
+  CHECK(state.reset(ConnectionState::Reading));
+  CHECK_FALSE(state.reset(ConnectionState::Reading));
+  CHECK_FALSE(state.flip(ConnectionState::Closing));
+  CHECK(state.test(ConnectionState::Closing));
+
+  CHECK_THROWS_AS(state.set(static_cast<ConnectionState>(100)), std::out_of_range);
+}
+
+TEST_CASE("atomic_bitset: whole set operations", "[atomic_bitset]")
+{
+  using bitset_type = enchantum::atomic_bitset<ConnectionState>::bitset_type;
+  enchantum::atomic_bitset<ConnectionState> state{ConnectionState::Open};
+
+  const auto before = state.fetch_or(bitset_type{ConnectionState::Reading, ConnectionState::Writing});
+  CHECK(before == bitset_type{ConnectionState::Open});
+  CHECK(state.load() == bitset_type{ConnectionState::Open, ConnectionState::Reading, ConnectionState::Writing});
+
+  state.fetch_and(bitset_type{ConnectionState::Open, ConnectionState::Writing});
+  CHECK(state.load() == bitset_type{ConnectionState::Open, ConnectionState::Writing});
+
+  auto expected = bitset_type{ConnectionState::Open};
+  CHECK_FALSE(state.compare_exchange_strong(expected, bitset_type{ConnectionState::Closing}));
+  CHECK(expected == bitset_type{ConnectionState::Open, ConnectionState::Writing});
+  CHECK(state.compare_exchange_strong(expected, bitset_type{ConnectionState::Closing}));
+  CHECK(state.load() == bitset_type{ConnectionState::Closing});
+
+  state.store(bitset_type{});
+  CHECK(state.load().none());
+}
+
+TEST_CASE("atomic_bitset: concurrent updates", "[atomic_bitset]")
+{
+  enchantum::atomic_bitset<Color> colors;
+  constexpr int                   rounds = 1000;
+
+  std::vector<std::thread> threads;
+  for (const auto color : enchantum::values<Color>) {
+    threads.emplace_back([&colors, color] {
+      for (int i = 0; i < rounds; ++i) {
+        colors.flip(color);
+        (void)colors.test(color);
+      }
+      colors.set(color);
+    });
+  }
+  for (auto& t : threads)
+    t.join();
+  CHECK(colors.load().all());
+}
+
+TEST_CASE("atomic_bitset: compare_exchange from many threads", "[atomic_bitset]")
+{
+  using bitset_type = enchantum::atomic_bitset<ConnectionState>::bitset_type;
+  enchantum::atomic_bitset<ConnectionState> state;
+
+  // only one thread may move the state from empty to open
+  std::atomic<int>         winners{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      auto expected = bitset_type{};
+      if (state.compare_exchange_strong(expected, bitset_type{ConnectionState::Open}))
+        ++winners;
+    });
+  }
+  for (auto& t : threads)
+    t.join();
+  CHECK(winners == 1);
+}
+
+#if defined(__cpp_lib_atomic_wait)
+TEST_CASE("atomic_bitset: wait until a flag is raised", "[atomic_bitset]")
+{
+  enchantum::atomic_bitset<ConnectionState> state;
+  int                                       payload = 0;
+
+  std::thread writer([&] {
+    payload = 42;
+    state.set(ConnectionState::Authenticated);
+    state.notify_all(ConnectionState::Authenticated);
+  });
+
+  state.wait(ConnectionState::Authenticated, false);
+  CHECK(payload == 42);
+  writer.join();
+
+  CHECK_THROWS_AS(state.notify_all(static_cast<ConnectionState>(100)), std::out_of_range);
+  CHECK_THROWS_AS(state.wait(static_cast<ConnectionState>(100), false), std::out_of_range);
+}
+#endif
@@ -1,5 +1,6 @@
 #include "case_insensitive.hpp"
 #include "test_utility.hpp"
+#include <algorithm>
 #include <array>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -21,6 +22,13 @@ enum class EntityStatus {
 };
 ENCHANTUM_DEFINE_BITWISE_FOR(EntityStatus)
 
+enum class SparseAccess : std::uint16_t {
+  Read  = 1 << 2,
+  Write = 1 << 7,
+  Exec  = 1 << 11,
+};
+ENCHANTUM_DEFINE_BITWISE_FOR(SparseAccess)
+
 } // namespace
 
 enum class Permission : int {
@@ -202,6 +210,34 @@ TEST_CASE("contains_bitflag", "[contains][bitflags]")
   }
 }
 
+TEST_CASE("cast_bitflag and contains_bitflag skip spaces around separators", "[casts][contains][bitflags]")
+{
+  using enchantum::bitflag_spaces;
+  STATIC_CHECK(enchantum::cast_bitflag<EntityStatus>("Active | Pending", '|', bitflag_spaces::trim) ==
+               (EntityStatus::Active | EntityStatus::Pending));
+  STATIC_CHECK(enchantum::cast_bitflag<EntityStatus>(" Active,\tInactive ", ',', bitflag_spaces::trim) ==
+               (EntityStatus::Active | EntityStatus::Inactive));
+  STATIC_CHECK(enchantum::cast_bitflag<EntityStatus>("pending | active", '|', case_insensitive, bitflag_spaces::trim) ==
+               (EntityStatus::Active | EntityStatus::Pending));
+  STATIC_CHECK(enchantum::contains_bitflag<SparseAccess>("Read |Write| Exec", '|', bitflag_spaces::trim));
+
+  STATIC_CHECK_FALSE(enchantum::cast_bitflag<EntityStatus>("Act ive|Pending", '|', bitflag_spaces::trim));
+  STATIC_CHECK_FALSE(enchantum::cast_bitflag<EntityStatus>("Active||Pending", '|', bitflag_spaces::trim));
+  STATIC_CHECK_FALSE(enchantum::cast_bitflag<EntityStatus>("Active| ", '|', bitflag_spaces::trim));
+  STATIC_CHECK_FALSE(enchantum::cast_bitflag<EntityStatus>("", '|', bitflag_spaces::trim));
+  STATIC_CHECK_FALSE(enchantum::contains_bitflag<SparseAccess>("Read|Writ", '|', bitflag_spaces::trim));
+}
+
+TEST_CASE("cast_bitflag and contains_bitflag reject spaces by default", "[casts][contains][bitflags]")
+{
+  STATIC_CHECK_FALSE(enchantum::cast_bitflag<EntityStatus>("Active | Pending"));
+  STATIC_CHECK_FALSE(enchantum::cast_bitflag<EntityStatus>(" Active"));
+  STATIC_CHECK_FALSE(enchantum::cast_bitflag<EntityStatus>("pending | active", '|', case_insensitive));
+  STATIC_CHECK_FALSE(enchantum::contains_bitflag<SparseAccess>("Read |Write"));
+  STATIC_CHECK_FALSE(enchantum::contains_bitflag<SparseAccess>("Read| Write", '|', case_insensitive));
+  STATIC_CHECK(enchantum::cast_bitflag<EntityStatus>("Active|Pending") == (EntityStatus::Active | EntityStatus::Pending));
+}
+
 TEST_CASE("contains_bitflag_with_invalid_bits", "[bitflags]")
 {
   SECTION("Contains invalid bits in DirectionFlags")
@@ -252,6 +288,54 @@ TEMPLATE_LIST_TEST_CASE("bitflags", "[bitflags]", AllFlagsTestTypes)
     }
   }
 
+  SECTION("to_string_bitflag into a buffer")
+  {
+    for (const auto comb : combinations) {
+      const auto expected = enchantum::to_string_bitflag(comb, ',');
+      REQUIRE(expected.size() <= enchantum::max_bitflag_string_length<TestType>);
+
+      char       buffer[enchantum::max_bitflag_string_length<TestType> + 1];
+      const auto [ptr, ec] = enchantum::to_string_bitflag(buffer, buffer + sizeof(buffer), comb, ',');
+      CHECK(ec == std::errc{});
+      CHECK(std::string_view(buffer, static_cast<std::size_t>(ptr - buffer)) == expected);
+
+      if (!expected.empty()) {
+        const auto too_small = enchantum::to_string_bitflag(buffer, buffer + expected.size() - 1, comb, ',');
+        CHECK(too_small.ec == std::errc::value_too_large);
+        CHECK(too_small.ptr == buffer + expected.size() - 1);
+      }
+    }
+    CHECK(enchantum::to_string_bitflag(enchantum::value_ors<TestType>).size() ==
+          enchantum::max_bitflag_string_length<TestType>);
+  }
+
+  SECTION("to_string_bitflag into a buffer with the default separator")
+  {
+    for (const auto comb : combinations) {
+      auto expected = enchantum::to_string_bitflag(comb, ',');
+      std::replace(expected.begin(), expected.end(), ',', '|');
+
+      char       buffer[enchantum::max_bitflag_string_length<TestType>];
+      const auto [ptr, ec] = enchantum::to_string_bitflag(buffer, buffer + sizeof(buffer), comb);
+      CHECK(ec == std::errc{});
+      CHECK(std::string_view(buffer, static_cast<std::size_t>(ptr - buffer)) == expected);
+      CHECK(enchantum::to_string_bitflag(comb) == expected);
+
+      if (!expected.empty())
+        CHECK(enchantum::to_string_bitflag(buffer, buffer + expected.size() - 1, comb).ec == std::errc::value_too_large);
+    }
+  }
+
+  SECTION("to_string_bitflag_view")
+  {
+    if constexpr (enchantum::details::has_flag_view<TestType>) {
+      for (const auto comb : combinations) {
+        CHECK(enchantum::to_string_bitflag_view<','>(comb) == enchantum::to_string_bitflag(comb, ','));
+        CHECK(enchantum::to_string_bitflag_view(comb) == enchantum::to_string_bitflag(comb));
+      }
+    }
+  }
+
   SECTION("contains_bitflag(enum)")
   {
     for (const auto comb : combinations) {
@@ -283,6 +367,43 @@ TEMPLATE_LIST_TEST_CASE("bitflags", "[bitflags]", AllFlagsTestTypes)
   }
 }
 
+TEST_CASE("to_string_bitflag set bit iteration", "[bitflags]")
+{
+  STATIC_CHECK(enchantum::details::has_single_bit_flags<SparseAccess>);
+  STATIC_CHECK_FALSE(enchantum::is_contiguous_bitflag<SparseAccess>);
+
+  CHECK(enchantum::to_string_bitflag(SparseAccess::Exec | SparseAccess::Read) == "Read|Exec");
+  CHECK(enchantum::to_string_bitflag(SparseAccess::Write) == "Write");
+  CHECK(enchantum::to_string_bitflag(static_cast<SparseAccess>(1 << 3)).empty());
+  CHECK(enchantum::to_string_bitflag(static_cast<SparseAccess>(0)).empty());
+}
+
+TEST_CASE("to_string_bitflag_view", "[bitflags]")
+{
+  STATIC_CHECK(enchantum::to_string_bitflag_view(EntityStatus::Active | EntityStatus::Pending) == "Active|Pending");
+  STATIC_CHECK(enchantum::to_string_bitflag_view<','>(SparseAccess::Exec | SparseAccess::Write) == "Write,Exec");
+  STATIC_CHECK(enchantum::to_string_bitflag_view(Permission::None) == "None");
+  STATIC_CHECK(enchantum::to_string_bitflag_view(static_cast<EntityStatus>(0)).empty());
+  STATIC_CHECK(enchantum::to_string_bitflag_view(static_cast<EntityStatus>(8)).empty());
+  STATIC_CHECK(enchantum::to_string_bitflag_view(static_cast<SparseAccess>(1 << 3)).empty());
+}
+
+TEST_CASE("to_string_bitflag into a buffer in constant evaluation", "[bitflags]")
+{
+  STATIC_CHECK(enchantum::max_bitflag_string_length<EntityStatus> == 23);
+  constexpr auto result = [] {
+    std::array<char, enchantum::max_bitflag_string_length<EntityStatus>> buffer{};
+    const auto [ptr, ec] = enchantum::to_string_bitflag(buffer.data(),
+                                                        buffer.data() + buffer.size(),
+                                                        EntityStatus::Active | EntityStatus::Pending);
+    return std::pair{buffer, ec == std::errc{} ? ptr - buffer.data() : -1};
+  }();
+  STATIC_CHECK(std::string_view(result.first.data(), static_cast<std::size_t>(result.second)) == "Active|Pending");
+
+  char buffer[32];
+  CHECK(enchantum::to_string_bitflag(buffer, buffer + 32, static_cast<EntityStatus>(16)).ec == std::errc::invalid_argument);
+}
+
 TEMPLATE_LIST_TEST_CASE("contains_bitflag returns false for invalid combinations", "[bitflags]", AllFlagsTestTypes)
 {
   using Underlying = std::underlying_type_t<TestType>;
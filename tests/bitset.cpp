@@ -1,8 +1,12 @@
 #include "test_utility.hpp"
 #include <algorithm>
+#include <bitset>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <enchantum/bitset.hpp>
+#include <random>
+#include <sstream>
+#include <vector>
 
 TEMPLATE_LIST_TEST_CASE("bitset identities", "[bitset]", AllEnumsTestTypes)
 {
@@ -111,6 +115,41 @@ TEST_CASE("bitset: to_string binary", "[bitset]")
   REQUIRE(std::count(binary.begin(), binary.end(), '1') == 1);
 }
 
+TEST_CASE("bitset: stream operators", "[bitset]")
+{
+  enchantum::bitset<Color> colors{Color::Aqua, Color::Red};
+  const auto               binary = colors.to_string('0', '1');
+
+  std::ostringstream os;
+  os << colors;
+  CHECK(os.str() == binary);
+
+  enchantum::bitset<Color> read;
+  std::istringstream       is("  " + binary + "2");
+  is >> read;
+  CHECK_FALSE(is.fail());
+  CHECK(read == colors);
+  CHECK(is.get() == '2');
+
+  // at most `size()` characters
+  std::istringstream longer("1" + binary);
+  longer >> read;
+  CHECK(read.to_string('0', '1') == "1" + binary.substr(0, binary.size() - 1));
+  CHECK(longer.get() == binary.back());
+
+  std::istringstream shorter("11");
+  shorter >> read;
+  CHECK(read.count() == 2);
+  CHECK(read.test(Color::Aqua));
+  CHECK(read.test(Color::Purple));
+  CHECK(shorter.eof());
+
+  std::istringstream invalid("x");
+  invalid >> read;
+  CHECK(invalid.fail());
+  CHECK(read.count() == 2);
+}
+
 TEST_CASE("bitset: operator[] and reference access", "[bitset]")
 {
   enchantum::bitset<Color> colors;
@@ -121,3 +160,109 @@ TEST_CASE("bitset: operator[] and reference access", "[bitset]")
   colors[Color::Purple] = false;
   REQUIRE_FALSE(colors.test(Color::Purple));
 }
+
+TEST_CASE("bitset: for_each visits set members in order", "[bitset]")
+{
+  enchantum::bitset<Color> colors{Color::Purple, Color::Green, Color::Aqua};
+
+  std::vector<Color> visited;
+  colors.for_each([&visited](const Color c) { visited.push_back(c); });
+  std::vector<Color> expected;
+  for (const auto c : enchantum::values<Color>)
+    if (colors.test(c))
+      expected.push_back(c);
+  REQUIRE(visited == expected);
+}
+
+TEST_CASE("bitset: constant evaluation", "[bitset]")
+{
+  constexpr auto colors = [] {
+    enchantum::bitset<Color> ret{Color::Aqua, Color::Green};
+    ret.flip(Color::Aqua);
+    ret |= enchantum::bitset<Color>{Color::Red};
+    return ret;
+  }();
+  STATIC_CHECK(colors.count() == 2);
+  STATIC_CHECK(colors[Color::Green]);
+  STATIC_CHECK(colors[Color::Red]);
+  STATIC_CHECK_FALSE(colors[Color::Aqua]);
+
+  constexpr auto without_red = [colors] {
+    auto ret = colors;
+    ret.and_not(enchantum::bitset<Color>{Color::Red, Color::Blue});
+    return ret;
+  }();
+  STATIC_CHECK(without_red.count() == 1);
+  STATIC_CHECK(without_red[Color::Green]);
+
+#if defined(__cpp_lib_constexpr_string) && __cpp_lib_constexpr_string >= 201907L
+  STATIC_CHECK(colors.to_string('0', '1').size() == enchantum::count<Color>);
+#endif
+}
+
+template<std::size_t N>
+using bit_count = std::integral_constant<std::size_t, N>;
+
+using BitCounts = type_list<bit_count<1>, bit_count<63>, bit_count<64>, bit_count<65>, bit_count<300>>;
+
+TEMPLATE_LIST_TEST_CASE("word_bitset matches std::bitset", "[bitset]", BitCounts)
+{
+  constexpr auto N = TestType::value;
+  std::mt19937_64 rng(N);
+  for (int round = 0; round < 20; ++round) {
+    std::bitset<N>                     a, b;
+    enchantum::details::word_bitset<N> x, y;
+    for (std::size_t i = 0; i < N; ++i) {
+      const bool v = rng() % 2 == 0, w = rng() % 3 == 0;
+      a[i] = v;
+      x[i] = v;
+      b[i] = w;
+      y[i] = w;
+    }
+    const auto shift = static_cast<std::size_t>(rng() % (N + 2));
+
+    CHECK((a & b).to_string() == (x & y).to_string());
+    CHECK((a | b).to_string() == (x | y).to_string());
+    CHECK((a ^ b).to_string() == (x ^ y).to_string());
+    CHECK((~a).to_string() == (~x).to_string());
+    CHECK((a & ~b).to_string() == enchantum::details::word_bitset<N>(x).and_not(y).to_string());
+    CHECK((a << shift).to_string() == (x << shift).to_string());
+    CHECK((a >> shift).to_string() == (x >> shift).to_string());
+    CHECK(a.count() == x.count());
+    CHECK(enchantum::details::word_bitset<N>(a.to_string()) == x);
+
+    std::size_t visited = 0;
+    for (auto i = x.find_first(); i != N; i = x.find_next(i), ++visited)
+      CHECK(a[i]);
+    CHECK(visited == a.count());
+  }
+  CHECK(enchantum::details::word_bitset<N>().set().all());
+  CHECK(enchantum::details::word_bitset<N>().set().count() == N);
+}
+
+TEMPLATE_LIST_TEST_CASE("bitset: from_flags and to_flags", "[bitset][bitflags]", AllFlagsTestTypes)
+{
+  using T              = std::underlying_type_t<TestType>;
+  constexpr auto first = std::size_t{enchantum::has_zero_flag<TestType>};
+  constexpr auto flags = enchantum::count<TestType> - first;
+  for (std::uint64_t mask = 0; mask < (std::uint64_t{1} << flags); ++mask) {
+    T value{};
+    for (std::size_t i = 0; i < flags; ++i)
+      if ((mask >> i) & 1)
+        value = static_cast<T>(value | static_cast<T>(enchantum::values<TestType>[first + i]));
+
+    const auto bitset = enchantum::bitset<TestType>::from_flags(static_cast<TestType>(value));
+    CHECK(bitset.count() == static_cast<std::size_t>(std::bitset<64>(mask).count()));
+    for (std::size_t i = first; i < enchantum::count<TestType>; ++i)
+      CHECK(bitset[i] == bool((mask >> (i - first)) & 1));
+    CHECK(static_cast<T>(bitset.to_flags()) == value);
+  }
+}
+
+TEST_CASE("bitset: from_flags in constant evaluation", "[bitset][bitflags]")
+{
+  STATIC_CHECK(enchantum::bitset<NonContigFlagsWithNoneCStyle>::from_flags(Flag1 | Flag6).to_flags() == (Flag1 | Flag6));
+  STATIC_CHECK(enchantum::bitset<NonContigFlagsWithNoneCStyle>::from_flags(Flag6)[NonContigFlagsWithNoneCStyle::Flag6]);
+  STATIC_CHECK_FALSE(enchantum::bitset<NonContigFlagsWithNoneCStyle>::from_flags(None)[None]);
+  STATIC_CHECK(enchantum::bitset<Flags>::from_flags(static_cast<Flags>(0xFF)).count() == enchantum::count<Flags>);
+}
@@ -0,0 +1,83 @@
+#include "test_utility.hpp"
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/bulk.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+// `std::vector<bool>` has no `data()`
+template<typename T>
+using stored_t = std::conditional_t<std::is_same_v<T, bool>, unsigned char, T>;
+
+// every member and its neighbours
+template<typename E>
+std::vector<stored_t<std::underlying_type_t<E>>> underlying_inputs()
+{
+  using T = std::underlying_type_t<E>;
+  std::vector<stored_t<T>> inputs;
+  for (const auto e : enchantum::values<E>) {
+    const auto v = static_cast<T>(e);
+    inputs.push_back(static_cast<stored_t<T>>(v));
+    inputs.push_back(static_cast<stored_t<T>>(v + 1));
+    inputs.push_back(static_cast<stored_t<T>>(v - 1));
+  }
+  return inputs;
+}
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("bulk functions match their scalar versions", "[bulk]", AllEnumsTestTypes)
+{
+  const auto              underlying = underlying_inputs<TestType>();
+  std::vector<TestType>   values;
+  std::vector<std::string> names;
+  for (const auto v : underlying) {
+    values.push_back(static_cast<TestType>(v));
+    names.emplace_back(enchantum::to_string(static_cast<TestType>(v)));
+  }
+  names.emplace_back("NotAMember");
+
+  std::vector<enchantum::string_view> to_string_out(values.size());
+  enchantum::bulk::to_string(values, to_string_out);
+  for (std::size_t i = 0; i < values.size(); ++i)
+    CHECK(to_string_out[i] == enchantum::to_string(values[i]));
+
+  std::vector<std::optional<TestType>> cast_out(names.size());
+  enchantum::bulk::cast<TestType>(names, cast_out);
+  for (std::size_t i = 0; i < names.size(); ++i)
+    CHECK(cast_out[i] == enchantum::cast<TestType>(names[i]));
+
+  std::vector<char> contains_out(underlying.size());
+  enchantum::bulk::contains<TestType>(underlying, contains_out);
+  for (std::size_t i = 0; i < underlying.size(); ++i)
+    CHECK(bool(contains_out[i]) == enchantum::contains<TestType>(static_cast<std::underlying_type_t<TestType>>(underlying[i])));
+
+  enchantum::bulk::contains<TestType>(values, contains_out);
+  for (std::size_t i = 0; i < values.size(); ++i)
+    CHECK(bool(contains_out[i]) == enchantum::contains(values[i]));
+}
+
+TEST_CASE("bulk functions in constant evaluation", "[bulk]")
+{
+  constexpr auto names = [] {
+    const Color                        values[] = {Color::Green, static_cast<Color>(0), Color::Aqua};
+    std::array<enchantum::string_view, 3> out{};
+    enchantum::bulk::to_string(values, out);
+    return out;
+  }();
+  STATIC_CHECK(names[0] == "Green");
+  STATIC_CHECK(names[1].empty());
+  STATIC_CHECK(names[2] == "Aqua");
+
+  constexpr auto contained = [] {
+    const std::uint8_t  values[] = {1, 3, 64, 128};
+    std::array<bool, 4> out{};
+    enchantum::bulk::contains<Flags>(values, out);
+    return out;
+  }();
+  STATIC_CHECK(contained[0]);
+  STATIC_CHECK_FALSE(contained[1]);
+  STATIC_CHECK(contained[2]);
+  STATIC_CHECK_FALSE(contained[3]);
+}
@@ -0,0 +1,116 @@
+#include "test_utility.hpp"
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/charconv.hpp>
+#include <string_view>
+
+TEMPLATE_LIST_TEST_CASE("to_chars and from_chars round trip", "[charconv]", AllEnumsTestTypes)
+{
+  for (const auto& [value, string] : enchantum::entries<TestType>) {
+    char       buffer[256];
+    const auto written = enchantum::to_chars(buffer, buffer + sizeof(buffer), value);
+    REQUIRE(written.ec == std::errc{});
+    CHECK(std::string_view(buffer, static_cast<std::size_t>(written.ptr - buffer)) == string);
+
+    TestType   read{};
+    const auto result = enchantum::from_chars(buffer, written.ptr, read);
+    CHECK(result.ec == std::errc{});
+    CHECK(result.ptr == written.ptr);
+    CHECK(read == value);
+  }
+}
+
+TEST_CASE("to_chars", "[charconv]")
+{
+  char buffer[32];
+  const auto text = [&buffer](const std::to_chars_result r) {
+    return std::string_view(buffer, static_cast<std::size_t>(r.ptr - buffer));
+  };
+
+  CHECK(text(enchantum::to_chars(buffer, buffer + sizeof(buffer), Color::Green)) == "Green");
+  CHECK(text(enchantum::to_chars(buffer, buffer + sizeof(buffer), Flags::Flag0 | Flags::Flag3)) == "Flag0|Flag3");
+
+  const auto unnamed = enchantum::to_chars(buffer, buffer + sizeof(buffer), static_cast<Color>(-7));
+  CHECK(unnamed.ec == std::errc::invalid_argument);
+  CHECK(unnamed.ptr == buffer);
+  CHECK(enchantum::to_chars(buffer, buffer + sizeof(buffer), Flags{}).ec == std::errc::invalid_argument);
+
+  const auto fallback = enchantum::chars_fallback::number;
+  CHECK(text(enchantum::to_chars(buffer, buffer + sizeof(buffer), static_cast<Color>(-7), fallback)) == "-7");
+  CHECK(text(enchantum::to_chars(buffer, buffer + sizeof(buffer), Flags{}, fallback)) == "0");
+  CHECK(text(enchantum::to_chars(buffer, buffer + sizeof(buffer), Flags(200), fallback)) == "200");
+  CHECK(text(enchantum::to_chars(buffer, buffer + sizeof(buffer), Color::Red, fallback)) == "Red");
+
+  const auto small = enchantum::to_chars(buffer, buffer + 4, Color::Green);
+  CHECK(small.ec == std::errc::value_too_large);
+  CHECK(small.ptr == buffer + 4);
+  CHECK(enchantum::to_chars(buffer, buffer + 3, Flags::Flag0 | Flags::Flag3).ec == std::errc::value_too_large);
+}
+
+TEST_CASE("from_chars tokenizes", "[charconv]")
+{
+  constexpr std::string_view input = "Green,Red Flag1|Flag2|;-12 Purplex 70000";
+  const char*                first = input.data();
+  const char* const          last  = input.data() + input.size();
+
+  Color color{};
+  auto  r = enchantum::from_chars(first, last, color);
+  CHECK(r.ec == std::errc{});
+  CHECK(color == Color::Green);
+  CHECK(*r.ptr == ',');
+
+  r = enchantum::from_chars(r.ptr + 1, last, color);
+  CHECK(r.ec == std::errc{});
+  CHECK(color == Color::Red);
+
+  Flags flags{};
+  r = enchantum::from_chars(r.ptr + 1, last, flags);
+  CHECK(r.ec == std::errc{});
+  CHECK(flags == (Flags::Flag1 | Flags::Flag2));
+  CHECK(*r.ptr == '|');
+
+  const auto number = r.ptr + 2;
+  r                 = enchantum::from_chars(number, last, color);
+  CHECK(r.ec == std::errc::invalid_argument);
+  CHECK(r.ptr == number);
+  CHECK(color == Color::Red);
+
+  r = enchantum::from_chars(number, last, color, enchantum::chars_fallback::number);
+  CHECK(r.ec == std::errc{});
+  CHECK(color == static_cast<Color>(-12));
+  CHECK(*r.ptr == ' ');
+
+  // a longer word is not a name
+  const auto word = r.ptr + 1;
+  r               = enchantum::from_chars(word, last, color);
+  CHECK(r.ec == std::errc::invalid_argument);
+  CHECK(r.ptr == word);
+
+  // out of the range of std::int16_t
+  const auto big = word + 8;
+  r              = enchantum::from_chars(big, last, color, enchantum::chars_fallback::number);
+  CHECK(r.ec == std::errc::result_out_of_range);
+  CHECK(r.ptr == last);
+  CHECK(color == static_cast<Color>(-12));
+}
+
+TEST_CASE("from_chars reads whole runs without spaces", "[charconv]")
+{
+  // the run has to be a name as a whole
+  constexpr std::string_view red_x = "RedX";
+  Color                      color = Color::Green;
+  auto                       r     = enchantum::from_chars(red_x.data(), red_x.data() + red_x.size(), color);
+  CHECK(r.ec == std::errc::invalid_argument);
+  CHECK(r.ptr == red_x.data());
+  CHECK(color == Color::Green);
+
+  // spaces end the run like `cast_bitflag` rejects them by default
+  constexpr std::string_view spaced = "Flag0 | Flag3";
+  Flags                      flags{};
+  r = enchantum::from_chars(spaced.data(), spaced.data() + spaced.size(), flags);
+  CHECK(r.ec == std::errc{});
+  CHECK(flags == Flags::Flag0);
+  CHECK(r.ptr == spaced.data() + 5);
+  CHECK_FALSE(enchantum::cast_bitflag<Flags>(spaced));
+  CHECK(enchantum::cast_bitflag<Flags>(spaced, '|', enchantum::bitflag_spaces::trim) == (Flags::Flag0 | Flags::Flag3));
+}
@@ -0,0 +1,56 @@
+#include "test_utility.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/counter_array.hpp>
+#include <thread>
+#include <vector>
+
+TEST_CASE("counter_array: add and load", "[counter_array]")
+{
+  enchantum::counter_array<Color> counters;
+
+  CHECK(counters.increment(Color::Green));
+  CHECK(counters.add(Color::Green, 4));
+  CHECK(counters.add(Color::Aqua, 2));
+  CHECK_FALSE(counters.add(static_cast<Color>(-1)));
+
+  CHECK(counters.load(Color::Green) == 5);
+  CHECK(counters.load(Color::Aqua) == 2);
+  CHECK(counters.load(Color::Red) == 0);
+  CHECK(counters.load(static_cast<Color>(-1)) == 0);
+
+  const auto snapshot = counters.snapshot();
+  CHECK(snapshot[Color::Green] == 5);
+  CHECK(snapshot[Color::Aqua] == 2);
+  CHECK(snapshot[Color::Purple] == 0);
+
+  counters.reset();
+  CHECK(counters.load(Color::Green) == 0);
+}
+
+TEST_CASE("counter_array: shards are cache line aligned", "[counter_array]")
+{
+  STATIC_CHECK(alignof(enchantum::counter_array<Color>) == enchantum::details::cache_line_size);
+  STATIC_CHECK(sizeof(enchantum::counter_array<Color, 4>) % enchantum::details::cache_line_size == 0);
+}
+
+TEST_CASE("counter_array: concurrent increments", "[counter_array]")
+{
+  enchantum::counter_array<Color, 4> counters;
+  constexpr std::uint64_t            rounds  = 10000;
+  constexpr int                      threads = 6;
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&counters] {
+      for (std::uint64_t i = 0; i < rounds; ++i)
+        for (const auto color : enchantum::values<Color>)
+          counters.increment(color);
+    });
+  }
+  for (auto& w : workers)
+    w.join();
+
+  const auto snapshot = counters.snapshot();
+  for (const auto color : enchantum::values<Color>)
+    CHECK(snapshot[color] == rounds * threads);
+}
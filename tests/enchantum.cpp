@@ -540,3 +540,34 @@ TEST_CASE("count", "[count]")
   STATIC_CHECK(enchantum::count<Direction2D> == 5);
   STATIC_CHECK(enchantum::count<Direction3D> == 7);
 }
+
+enum class FarApart : std::int16_t {
+  Low  = -3000,
+  High = 3000,
+};
+
+template<>
+struct enchantum::enum_traits<FarApart> {
+  static constexpr auto min = -3000;
+  static constexpr auto max = 3000;
+};
+
+TEST_CASE("index_layout", "[index_layout][enum_to_index]")
+{
+  STATIC_CHECK(enchantum::index_layout<ContigNonZero> == enchantum::index_layout_mode::contiguous);
+  STATIC_CHECK(enchantum::index_layout<Flags> == enchantum::index_layout_mode::contiguous_bitflag);
+  STATIC_CHECK(enchantum::index_layout<Color> == enchantum::index_layout_mode::rank_bitmap);
+  STATIC_CHECK(enchantum::index_layout<NonContigFlagsWithNoneCStyle> == enchantum::index_layout_mode::rank_bitmap);
+  STATIC_CHECK(enchantum::index_layout<FarApart> == enchantum::index_layout_mode::linear);
+
+  STATIC_CHECK(enchantum::enum_to_index(Color::Red) == 3);
+  STATIC_CHECK(enchantum::enum_to_index(Color::Blue) == 4);
+  STATIC_CHECK_FALSE(enchantum::enum_to_index(Color(22)).has_value());
+  STATIC_CHECK_FALSE(enchantum::enum_to_index(Color(-43)).has_value());
+  STATIC_CHECK_FALSE(enchantum::contains(Color(215)));
+  STATIC_CHECK_FALSE(enchantum::contains(Direction3D(6)));
+  STATIC_CHECK(enchantum::enum_to_index(Direction3D::Back) == 6);
+
+  STATIC_CHECK(enchantum::enum_to_index(FarApart::High) == 1);
+  STATIC_CHECK_FALSE(enchantum::contains(FarApart(0)));
+}
@@ -0,0 +1,60 @@
+#include "test_utility.hpp"
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <enchantum/find_all.hpp>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace {
+
+enum class Command { GET, GETEX, GETDEL, SET, SETEX, DEL };
+
+template<typename E>
+std::vector<std::pair<std::size_t, E>> find_all(const std::string_view text)
+{
+  std::vector<std::pair<std::size_t, E>> ret;
+  const auto found = enchantum::find_all<E>(text, [&ret](const std::size_t offset, const E value) {
+    ret.emplace_back(offset, value);
+  });
+  CHECK(found == ret.size());
+  return ret;
+}
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("find_all finds every name", "[find_all]", AllEnumsTestTypes)
+{
+  for (const auto& [value, string] : enchantum::entries<TestType>) {
+    const auto text  = "  " + std::string(string.data(), string.size()) + " ";
+    bool       found = false;
+    enchantum::find_all<TestType>(text, [&](const std::size_t offset, const TestType v) {
+      if (v == value) {
+        CHECK(offset == 2);
+        found = true;
+      }
+    });
+    CHECK(found);
+  }
+  CHECK(find_all<TestType>("").empty());
+  CHECK(find_all<TestType>(" \n\t~").empty());
+}
+
+TEST_CASE("find_all overlapping names", "[find_all]")
+{
+  using P = std::pair<std::size_t, Command>;
+  CHECK(find_all<Command>("GETDEL") == std::vector<P>{{0, Command::GET}, {0, Command::GETDEL}, {3, Command::DEL}});
+  CHECK(find_all<Command>("GEGETSEDELL") == std::vector<P>{{2, Command::GET}, {7, Command::DEL}});
+
+  const auto found = find_all<Command>("x SETEX,GETEX;");
+  CHECK(found == std::vector<P>{{2, Command::SET}, {2, Command::SETEX}, {8, Command::GET}, {8, Command::GETEX}});
+  CHECK(find_all<Command>("get set del").empty());
+}
+
+TEST_CASE("find_all at compile time", "[find_all]")
+{
+  STATIC_CHECK(enchantum::find_all<Command>(enchantum::string_view("GETDEL SET", 10), [](std::size_t, Command) {}) ==
+               4);
+}
@@ -55,3 +55,50 @@ TEST_CASE("Flags enum fmt::format", "[stringify][fmt_format]")
     CHECK(fmt::format("{}", enchantum::value_ors<Flags>) == "Flag0|Flag1|Flag2|Flag3|Flag4|Flag5|Flag6");
   }
 }
+
+TEST_CASE("fmt::format numbers and format specs", "[stringify][fmt_format]")
+{
+  CHECK(fmt::format("{}", Flags{}) == "0");
+  CHECK(fmt::format("{}", FlagsWithNone::None) == "None");
+  CHECK(fmt::format("{}", static_cast<Color>(-1000)) == "-1000");
+  CHECK(fmt::format("{}", static_cast<Color>(32767)) == "32767");
+  CHECK(fmt::format("[{:>8}]", Color::Red) == "[     Red]");
+  CHECK(fmt::format("[{:*<13}]", Flags::Flag0 | Flags::Flag4) == "[Flag0|Flag4**]");
+  CHECK(fmt::format("[{:.3}]", Color::Purple) == "[Pur]");
+}
+
+TEST_CASE("fmt::format modes", "[stringify][fmt_format]")
+{
+  CHECK(fmt::format("{:d}", Color::Green) == "124");
+  CHECK(fmt::format("{:d}", Color::Aqua) == "-42");
+  CHECK(fmt::format("{:x}", Color::Red) == "d5");
+  CHECK(fmt::format("{:X}", Color::Red) == "D5");
+  CHECK(fmt::format("{:x}", Color::Aqua) == "ffd6");
+  CHECK(fmt::format("[{:6d}]", Color::Green) == "[   124]");
+  CHECK(fmt::format("[{:0<6x}]", Color::Red) == "[d50000]");
+
+  CHECK(fmt::format("{:s}", Color::Green) == "Color::Green");
+  CHECK(fmt::format("[{:>14s}]", Color::Red) == "[    Color::Red]");
+  CHECK(fmt::format("[{:^14.8s}]", Color::Red) == "[   Color::R   ]");
+  CHECK(fmt::format("{:s}", static_cast<Color>(1)) == "1");
+  CHECK(fmt::format("{:s}", Flags::Flag0 | Flags::Flag4) == "Flags::Flag0|Flags::Flag4");
+  CHECK(fmt::format("{:s}", FlagsWithNone::None) == "FlagsWithNone::None");
+
+  CHECK(fmt::format("{:|,}", Flags::Flag0 | Flags::Flag4) == "Flag0,Flag4");
+  CHECK(fmt::format("{:|}", Flags::Flag0 | Flags::Flag4) == "Flag0|Flag4");
+  CHECK(fmt::format("[{:-^13|+}]", Flags::Flag1 | Flags::Flag2) == "[-Flag1+Flag2-]");
+  CHECK(fmt::format("{:|,}", Flags{}) == "0");
+  CHECK(fmt::format("{:|,}", Flags(200)) == "200");
+
+  // fill followed by an alignment is not a mode
+  CHECK(fmt::format("[{:d>7}]", Color::Red) == "[ddddRed]");
+  CHECK(fmt::format("[{:|<7}]", Color::Red) == "[Red||||]");
+}
+
+TEST_CASE("fmt::format invalid modes", "[stringify][fmt_format]")
+{
+  const auto value = Color::Red;
+  CHECK_THROWS_AS(fmt::format(fmt::runtime("{:.3d}"), value), fmt::format_error);
+  CHECK_THROWS_AS(fmt::format(fmt::runtime("{:|,}"), value), fmt::format_error);
+  CHECK_THROWS_AS(fmt::format(fmt::runtime("{:{}s}"), value), fmt::format_error);
+}
@@ -0,0 +1,108 @@
+#include "test_utility.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/histogram_array.hpp>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+TEST_CASE("histogram_snapshot: bucket bounds", "[histogram_array]")
+{
+  using H = enchantum::histogram_snapshot<3>;
+  STATIC_CHECK(H::bucket_count == 62 * 8);
+  STATIC_CHECK(H::bucket_index(0) == 0);
+  STATIC_CHECK(H::bucket_index(7) == 7);
+  STATIC_CHECK(H::bucket_index(8) == 8);
+  STATIC_CHECK(H::bucket_index(15) == 15);
+  STATIC_CHECK(H::bucket_index(16) == 16);
+  STATIC_CHECK(H::bucket_index(17) == 16);
+  STATIC_CHECK(H::bucket_index(UINT64_MAX) == H::bucket_count - 1);
+  STATIC_CHECK(H::bucket_upper(H::bucket_count - 1) == UINT64_MAX);
+
+  for (std::size_t i = 0; i < H::bucket_count; ++i) {
+    CHECK(H::bucket_index(H::bucket_lower(i)) == i);
+    CHECK(H::bucket_index(H::bucket_upper(i)) == i);
+    if (i + 1 < H::bucket_count)
+      CHECK(H::bucket_upper(i) + 1 == H::bucket_lower(i + 1));
+  }
+}
+
+TEST_CASE("histogram_array: record and percentiles", "[histogram_array]")
+{
+  enchantum::histogram_array<Color> histograms;
+
+  for (std::uint64_t i = 1; i <= 1000; ++i)
+    CHECK(histograms.record(Color::Green, i));
+  CHECK(histograms.record(Color::Aqua, 3));
+  CHECK_FALSE(histograms.record(static_cast<Color>(-1), 3));
+
+  const auto green = histograms.snapshot(Color::Green);
+  CHECK(green.count() == 1000);
+  CHECK(green.sum == 500500);
+  CHECK(green.mean() == 500.5);
+  CHECK(green.percentile(0) == 1);
+  CHECK(green.percentile(100) == 1023);
+  // every bucket is at most 1/8 of its values wide
+  const auto p50 = green.percentile(50);
+  CHECK(p50 >= 500);
+  CHECK(p50 <= 500 + 500 / 8);
+  const auto p99 = green.percentile(99);
+  CHECK(p99 >= 990);
+  CHECK(p99 <= 990 + 990 / 8);
+
+  CHECK(histograms.snapshot(Color::Aqua).percentile(50) == 3);
+  CHECK(histograms.snapshot(Color::Red).count() == 0);
+  CHECK(histograms.snapshot(Color::Red).percentile(50) == 0);
+  CHECK(histograms.snapshot(static_cast<Color>(-1)).count() == 0);
+
+  const auto all = histograms.snapshot();
+  CHECK(all[Color::Green].count() == 1000);
+  CHECK(all[Color::Aqua].count() == 1);
+
+  // filled in place without a copy on the stack, earlier contents are replaced
+  using Snapshots = enchantum::array<Color, enchantum::histogram_array<Color>::snapshot_type>;
+  const auto out  = std::make_unique<Snapshots>();
+  (*out)[Color::Red].total = 5;
+  histograms.snapshot(*out);
+  CHECK((*out)[Color::Green].count() == 1000);
+  CHECK((*out)[Color::Green].buckets == all[Color::Green].buckets);
+  CHECK((*out)[Color::Red].count() == 0);
+
+  std::vector<std::string_view> labels;
+  std::uint64_t                 total = 0;
+  histograms.for_each([&](const auto name, const auto& snapshot) {
+    labels.emplace_back(name.data(), name.size());
+    total += snapshot.count();
+  });
+  CHECK(labels.size() == enchantum::count<Color>);
+  CHECK(labels[0] == enchantum::names<Color>[0]);
+  CHECK(total == 1001);
+
+  histograms.reset();
+  CHECK(histograms.snapshot(Color::Green).count() == 0);
+  CHECK(histograms.snapshot(Color::Green).sum == 0);
+}
+
+TEST_CASE("histogram_array: concurrent records", "[histogram_array]")
+{
+  enchantum::histogram_array<Color, 4> histograms;
+  constexpr std::uint64_t              rounds  = 2000;
+  constexpr int                        threads = 6;
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&histograms] {
+      for (std::uint64_t i = 0; i < rounds; ++i)
+        for (const auto color : enchantum::values<Color>)
+          histograms.record(color, i);
+    });
+  }
+  for (auto& w : workers)
+    w.join();
+
+  for (const auto color : enchantum::values<Color>) {
+    const auto snapshot = histograms.snapshot(color);
+    CHECK(snapshot.count() == rounds * threads);
+    CHECK(snapshot.sum == threads * rounds * (rounds - 1) / 2);
+  }
+}
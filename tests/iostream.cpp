@@ -1,9 +1,13 @@
 #include "test_utility.hpp"
+#include <algorithm>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <enchantum/enchantum.hpp>
 #include <enchantum/iostream.hpp>
+#include <iomanip>
+#include <locale>
 #include <sstream>
+#include <string>
 
 using namespace enchantum::iostream_operators;
 
@@ -61,3 +65,101 @@ TEST_CASE("ostream operator<< return numbers if invalid enum", "[ostream]")
   CHECK(tostringoss(Flags::Flag0 | Flags::Flag1) == "Flag0|Flag1");
   CHECK(tostringoss(Flags::Flag0 | Flags(1u << 7)) == std::to_string(1 | (1u << 7)));
 }
+
+TEST_CASE("ostream operator<< keeps the stream width", "[ostream]")
+{
+  auto oss = std::ostringstream();
+  oss << '[' << std::setw(6) << Color::Red << ']' << std::left << std::setfill('*') << std::setw(8)
+      << (Flags::Flag0 | Flags::Flag1) << '|' << Color::Green;
+  CHECK(oss.str() == "[   Red]Flag0|Flag1|Green");
+
+  auto padded = std::ostringstream();
+  padded << std::left << std::setfill('*') << std::setw(14) << (Flags::Flag0 | Flags::Flag1) << Color::Green;
+  CHECK(padded.str() == "Flag0|Flag1***Green");
+
+  // like a string `internal` pads before the name
+  auto internal = std::ostringstream();
+  internal << std::internal << std::setfill('-') << std::setw(7) << Color::Blue << std::setw(2) << Color::Green;
+  CHECK(internal.str() == "---BlueGreen");
+}
+
+TEST_CASE("istream operator>> reads one word", "[istream]")
+{
+  auto  iss = std::istringstream("  Red\tGreen\nFlag0|Flag3 Blue");
+  Color a{}, b{};
+  Flags flags{};
+  iss >> a >> b >> flags;
+  CHECK(a == Color::Red);
+  CHECK(b == Color::Green);
+  CHECK(flags == (Flags::Flag0 | Flags::Flag3));
+  CHECK(iss);
+
+  std::string rest;
+  iss >> rest;
+  CHECK(rest == "Blue");
+  CHECK(iss.eof());
+
+  auto  at_end = std::istringstream("Purple");
+  Color c{};
+  at_end >> c;
+  CHECK(c == Color::Purple);
+  CHECK(at_end.eof());
+  CHECK_FALSE(at_end.fail());
+
+  // words longer than every name are consumed and rejected without being stored
+  auto  too_long = std::istringstream("PurplePurplePurplePurple Red");
+  Color d{};
+  too_long >> d;
+  CHECK(d == Color{});
+  CHECK(too_long.fail());
+  too_long.clear();
+  too_long >> d;
+  CHECK(d == Color::Red);
+
+  auto  empty = std::istringstream("   ");
+  Color e{};
+  empty >> e;
+  CHECK(empty.fail());
+  CHECK(empty.eof());
+}
+
+namespace {
+
+// a locale where ',' is whitespace as well
+struct comma_space : std::ctype<char> {
+  static const mask* make_table()
+  {
+    static mask table[table_size];
+    std::copy(classic_table(), classic_table() + table_size, table);
+    table[static_cast<unsigned char>(',')] |= space;
+    return table;
+  }
+
+  comma_space() : std::ctype<char>(make_table()) {}
+};
+
+} // namespace
+
+TEST_CASE("istream operator>> uses the locale and width of the stream", "[istream]")
+{
+  auto iss = std::istringstream("Red,Green");
+  iss.imbue(std::locale(iss.getloc(), new comma_space));
+  Color a{}, b{};
+  iss >> a >> b;
+  CHECK(a == Color::Red);
+  CHECK(b == Color::Green);
+  CHECK_FALSE(iss.fail());
+
+  auto  sized = std::istringstream("RedGreen Purple");
+  Color c{}, d{};
+  sized >> std::setw(3) >> c;
+  CHECK(c == Color::Red);
+  CHECK(sized.width() == 0);
+  sized >> d;
+  CHECK(d == Color::Green);
+
+  // the width can cut a name short
+  sized >> std::setw(4) >> d;
+  CHECK(sized.fail());
+  CHECK(d == Color::Green);
+}
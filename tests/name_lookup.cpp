@@ -0,0 +1,261 @@
+#include "case_insensitive.hpp"
+#include "test_utility.hpp"
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/enchantum.hpp>
+#include <string>
+
+namespace {
+
+enum class ErrorCode : std::int16_t {
+  Ok                  = 0,
+  NotFound            = 4,
+  PermissionDenied    = 7,
+  Timeout             = 9,
+  ConnectionReset     = 12,
+  ConnectionRefused   = 13,
+  ConnectionAborted   = 14,
+  HostUnreachable     = 20,
+  NetworkUnreachable  = 21,
+  AddressInUse        = 30,
+  AddressNotAvailable = 31,
+  BrokenPipe          = 40,
+  AlreadyExists       = 41,
+  WouldBlock          = 42,
+  InvalidInput        = 50,
+  InvalidData         = 51,
+  TimedOut            = 52,
+  WriteZero           = 60,
+  Interrupted         = 61,
+  Unsupported         = 62,
+  UnexpectedEof       = 70,
+  OutOfMemory         = 71,
+  Other               = 99,
+  a                   = 100,
+  b                   = 101,
+  ab                  = 102,
+  ba                  = 103,
+};
+
+enum class Method {
+  GET,
+  PUT,
+  POST,
+  HEAD,
+  PATCH,
+  DELETE_,
+  OPTIONS,
+  TRACE,
+  CONNECT,
+};
+
+enum class Single {
+  Only
+};
+
+enum class Verb {
+  GET,
+  PUT,
+  POST,
+  HEAD,
+  PATCH,
+  DELETE_,
+  OPTIONS,
+  TRACE,
+  CONNECT,
+  PURGE,
+  LOCK,
+  UNLOCK,
+  MOVE,
+  COPY,
+};
+
+enum class Gaps {
+  x,
+  xyz,
+  xyzw_,
+  xyzwv,
+};
+
+enum class Short {
+  on,
+  off,
+  auto_,
+  enabled,
+  disabled,
+};
+
+enum class Wide {
+  short_name,
+  sixteen_chars_xx,
+  seventeen_chars_x,
+  a_name_that_is_thirty_one_long,
+  a_name_that_is_thirty_two_long_,
+};
+
+enum class TooWide {
+  tiny,
+  a_name_that_is_far_too_long_for_the_table,
+};
+
+} // namespace
+
+template<>
+inline constexpr enchantum::name_lookup_mode enchantum::name_lookup<ErrorCode> = enchantum::name_lookup_mode::perfect_hash;
+template<>
+inline constexpr enchantum::name_lookup_mode enchantum::name_lookup<Method> = enchantum::name_lookup_mode::perfect_hash;
+template<>
+inline constexpr enchantum::name_lookup_mode enchantum::name_lookup<Single> = enchantum::name_lookup_mode::perfect_hash;
+
+template<>
+inline constexpr enchantum::name_lookup_mode enchantum::name_lookup<Verb> = enchantum::name_lookup_mode::trie;
+template<>
+inline constexpr enchantum::name_lookup_mode enchantum::name_lookup<Gaps> = enchantum::name_lookup_mode::trie;
+
+template<>
+inline constexpr enchantum::name_lookup_mode enchantum::name_lookup<Short> = enchantum::name_lookup_mode::padded;
+template<>
+inline constexpr enchantum::name_lookup_mode enchantum::name_lookup<Wide> = enchantum::name_lookup_mode::padded;
+template<>
+inline constexpr enchantum::name_lookup_mode enchantum::name_lookup<TooWide> = enchantum::name_lookup_mode::padded;
+
+template<>
+inline constexpr enchantum::to_string_lookup_mode enchantum::to_string_lookup<ErrorCode> = enchantum::to_string_lookup_mode::switch_case;
+template<>
+inline constexpr enchantum::to_string_lookup_mode enchantum::to_string_lookup<Verb> = enchantum::to_string_lookup_mode::switch_case;
+template<>
+inline constexpr enchantum::to_string_lookup_mode enchantum::to_string_lookup<Single> = enchantum::to_string_lookup_mode::switch_case;
+
+using PerfectHashTestTypes = type_list<ErrorCode, Method, Single>;
+
+TEMPLATE_LIST_TEST_CASE("perfect hash cast(to_string()) identities", "[cast][name_lookup]", PerfectHashTestTypes)
+{
+  STATIC_CHECK(enchantum::details::name_hash_table<TestType>.valid);
+  for (const auto& [value, name] : enchantum::entries<TestType>) {
+    CHECK(enchantum::cast<TestType>(name) == value);
+    CHECK(enchantum::contains<TestType>(name));
+  }
+}
+
+TEST_CASE("perfect hash rejects non members", "[cast][name_lookup]")
+{
+  STATIC_CHECK(enchantum::cast<ErrorCode>("Timeout") == ErrorCode::Timeout);
+  STATIC_CHECK(enchantum::cast<ErrorCode>("ab") == ErrorCode::ab);
+  STATIC_CHECK(enchantum::contains<ErrorCode>("OutOfMemory"));
+
+  STATIC_CHECK_FALSE(enchantum::cast<ErrorCode>("timeout"));
+  STATIC_CHECK_FALSE(enchantum::cast<ErrorCode>("Timeou"));
+  STATIC_CHECK_FALSE(enchantum::cast<ErrorCode>("aa"));
+  STATIC_CHECK_FALSE(enchantum::cast<ErrorCode>(""));
+  STATIC_CHECK_FALSE(enchantum::contains<ErrorCode>("NotAnErrorCodeAtAllReally"));
+
+  STATIC_CHECK(enchantum::cast<Method>("POST") == Method::POST);
+  STATIC_CHECK_FALSE(enchantum::cast<Method>("PUST"));
+  STATIC_CHECK_FALSE(enchantum::cast<Single>("Onl"));
+  STATIC_CHECK_FALSE(enchantum::cast<Single>("Onlx"));
+}
+
+using TrieTestTypes = type_list<Verb, Gaps>;
+
+TEMPLATE_LIST_TEST_CASE("trie cast(to_string()) identities", "[cast][name_lookup]", TrieTestTypes)
+{
+  for (const auto& [value, name] : enchantum::entries<TestType>) {
+    CHECK(enchantum::cast<TestType>(name) == value);
+    CHECK(enchantum::contains<TestType>(name));
+  }
+}
+
+TEST_CASE("trie rejects non members", "[cast][name_lookup]")
+{
+  STATIC_CHECK(enchantum::cast<Verb>("GET") == Verb::GET);
+  STATIC_CHECK(enchantum::cast<Verb>("PURGE") == Verb::PURGE);
+  STATIC_CHECK(enchantum::cast<Verb>("UNLOCK") == Verb::UNLOCK);
+  STATIC_CHECK(enchantum::contains<Verb>("COPY"));
+
+  STATIC_CHECK_FALSE(enchantum::cast<Verb>("GOT"));
+  STATIC_CHECK_FALSE(enchantum::cast<Verb>("PET"));
+  STATIC_CHECK_FALSE(enchantum::cast<Verb>("get"));
+  STATIC_CHECK_FALSE(enchantum::cast<Verb>("PATCHY"));
+  STATIC_CHECK_FALSE(enchantum::cast<Verb>(""));
+  STATIC_CHECK_FALSE(enchantum::contains<Verb>("MOVED"));
+
+  STATIC_CHECK(enchantum::cast<Gaps>("xyzw_") == Gaps::xyzw_);
+  STATIC_CHECK_FALSE(enchantum::cast<Gaps>("xy"));
+  STATIC_CHECK_FALSE(enchantum::cast<Gaps>("xyzw"));
+  STATIC_CHECK_FALSE(enchantum::cast<Gaps>("xyzwx"));
+}
+
+using PaddedTestTypes = type_list<Short, Wide, TooWide>;
+
+TEMPLATE_LIST_TEST_CASE("padded cast(to_string()) identities", "[cast][name_lookup]", PaddedTestTypes)
+{
+  for (const auto& [value, name] : enchantum::entries<TestType>) {
+    CHECK(enchantum::cast<TestType>(name) == value);
+    CHECK(enchantum::contains<TestType>(name));
+  }
+}
+
+TEST_CASE("padded rejects non members", "[cast][name_lookup]")
+{
+  STATIC_CHECK(enchantum::details::padded_name_width<Short> == 16);
+  STATIC_CHECK(enchantum::details::padded_name_width<Wide> == 32);
+  STATIC_CHECK(enchantum::details::padded_name_width<TooWide> == 0);
+
+  STATIC_CHECK(enchantum::cast<Short>("off") == Short::off);
+  STATIC_CHECK(enchantum::cast<Wide>("a_name_that_is_thirty_two_long_") == Wide::a_name_that_is_thirty_two_long_);
+  STATIC_CHECK_FALSE(enchantum::cast<Short>("of"));
+  STATIC_CHECK_FALSE(enchantum::cast<Wide>("a_name_that_is_thirty_two_long!"));
+
+  using namespace std::string_view_literals;
+  CHECK(enchantum::cast<Short>("disabled"sv) == Short::disabled);
+  CHECK_FALSE(enchantum::cast<Short>("disable"sv));
+  CHECK_FALSE(enchantum::cast<Short>("disabler"sv));
+  CHECK_FALSE(enchantum::cast<Short>("on\0"sv));
+  CHECK_FALSE(enchantum::cast<Wide>("seventeen_chars_y"sv));
+  CHECK(enchantum::cast<TooWide>("a_name_that_is_far_too_long_for_the_table"sv) == TooWide::a_name_that_is_far_too_long_for_the_table);
+}
+
+using IcaseTestTypes = type_list<Color, Flags, ErrorCode, Verb, Short, Wide, TooWide>;
+
+TEMPLATE_LIST_TEST_CASE("cast_icase matches the case insensitive predicate", "[cast][name_lookup]", IcaseTestTypes)
+{
+  for (const auto& [value, name] : enchantum::entries<TestType>) {
+    std::string flipped(name);
+    for (auto& c : flipped)
+      c = (c >= 'a' && c <= 'z') ? char(c - 'a' + 'A') : (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+
+    CHECK(enchantum::cast_icase<TestType>(name) == value);
+    CHECK(enchantum::cast_icase<TestType>(flipped) == enchantum::cast<TestType>(flipped, case_insensitive));
+    CHECK(enchantum::contains_icase<TestType>(flipped));
+  }
+  CHECK_FALSE(enchantum::cast_icase<TestType>(""));
+  CHECK_FALSE(enchantum::contains_icase<TestType>("not a name"));
+}
+
+TEST_CASE("cast_icase in constant evaluation", "[cast][name_lookup]")
+{
+  STATIC_CHECK(enchantum::cast_icase<Color>("aQUA") == Color::Aqua);
+  STATIC_CHECK(enchantum::cast_icase<ErrorCode>("TIMEOUT") == ErrorCode::Timeout);
+  STATIC_CHECK(enchantum::cast_icase<Verb>("get") == Verb::GET);
+  STATIC_CHECK(enchantum::cast_icase<Short>("OFF") == Short::off);
+  STATIC_CHECK(enchantum::contains_icase<Wide>("SHORT_NAME"));
+  STATIC_CHECK_FALSE(enchantum::cast_icase<Verb>("gets"));
+  STATIC_CHECK_FALSE(enchantum::cast_icase<Short>("of"));
+}
+
+using SwitchToStringTestTypes = type_list<ErrorCode, Verb, Single>;
+
+TEMPLATE_LIST_TEST_CASE("switch to_string matches names", "[to_string][name_lookup]", SwitchToStringTestTypes)
+{
+  for (const auto& [value, name] : enchantum::entries<TestType>)
+    CHECK(enchantum::to_string(value) == name);
+  CHECK(enchantum::to_string(static_cast<TestType>(1000)).empty());
+}
+
+TEST_CASE("switch to_string in constant evaluation", "[to_string][name_lookup]")
+{
+  STATIC_CHECK(enchantum::to_string(ErrorCode::Timeout) == "Timeout");
+  STATIC_CHECK(enchantum::to_string(ErrorCode::ba) == "ba");
+  STATIC_CHECK(enchantum::to_string(Verb::CONNECT) == "CONNECT");
+  STATIC_CHECK(enchantum::to_string(static_cast<ErrorCode>(5)).empty());
+}
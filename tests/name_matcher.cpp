@@ -0,0 +1,71 @@
+#include "test_utility.hpp"
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/name_matcher.hpp>
+#include <string_view>
+
+namespace {
+
+enum class Command { GET, GETEX, GETDEL, SET, SETEX, DEL };
+
+} // namespace
+
+TEMPLATE_LIST_TEST_CASE("name_matcher matches every name", "[name_matcher]", AllEnumsTestTypes)
+{
+  for (const auto& [value, string] : enchantum::entries<TestType>) {
+    enchantum::name_matcher<TestType> matcher;
+    CHECK(matcher.feed(string) == enchantum::match_status::match);
+    CHECK(matcher.value() == value);
+    CHECK(matcher.size() == string.size());
+
+    // fed one byte at a time
+    enchantum::name_matcher<TestType> bytes;
+    for (const char c : string)
+      CHECK(bytes.feed(c) != enchantum::match_status::reject);
+    CHECK(bytes.value() == value);
+  }
+}
+
+TEST_CASE("name_matcher across chunks", "[name_matcher]")
+{
+  using enchantum::match_status;
+  enchantum::name_matcher<Command> matcher;
+  CHECK(matcher.status() == match_status::partial);
+  CHECK(matcher.candidates() == 6);
+
+  CHECK(matcher.feed(std::string_view("GE")) == match_status::partial);
+  CHECK(matcher.candidates() == 3);
+  CHECK_FALSE(matcher.value());
+
+  CHECK(matcher.feed(std::string_view("T")) == match_status::match);
+  CHECK(matcher.value() == Command::GET);
+  CHECK(matcher.candidates() == 3);
+
+  CHECK(matcher.feed(std::string_view("D")) == match_status::partial);
+  CHECK(matcher.candidates() == 1);
+  CHECK(matcher.feed(std::string_view("EL")) == match_status::match);
+  CHECK(matcher.value() == Command::GETDEL);
+
+  CHECK(matcher.feed('X') == match_status::reject);
+  CHECK_FALSE(matcher.value());
+  CHECK(matcher.feed(std::string_view("anything")) == match_status::reject);
+
+  matcher.reset();
+  CHECK(matcher.feed(std::string_view("SE")) == match_status::partial);
+  CHECK(matcher.feed(std::string_view("TEX")) == match_status::match);
+  CHECK(matcher.value() == Command::SETEX);
+
+  matcher.reset();
+  CHECK(matcher.feed(std::string_view("DELETE")) == match_status::reject);
+  CHECK(matcher.size() == 4);
+}
+
+TEST_CASE("name_matcher at compile time", "[name_matcher]")
+{
+  STATIC_CHECK([] {
+    enchantum::name_matcher<Command> matcher;
+    matcher.feed(enchantum::string_view("GETE", 4));
+    matcher.feed(enchantum::string_view("X", 1));
+    return matcher.value() == Command::GETEX;
+  }());
+}
@@ -0,0 +1,152 @@
+#include "test_utility.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/counter_array.hpp>
+#include <enchantum/openmetrics.hpp>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+enum class Method { Get, Put, Delete };
+
+template<typename E, typename V, typename... Args>
+std::string_view render(
+  char (&buffer)[1024], const char* metric, const char* label, const V& values, const Args&... args)
+{
+  const auto [ptr, ec] = enchantum::write_openmetrics(buffer, buffer + sizeof(buffer), metric, label, values, args...);
+  REQUIRE(ec == std::errc{});
+  return std::string_view(buffer, static_cast<std::size_t>(ptr - buffer));
+}
+
+} // namespace
+
+TEST_CASE("write_openmetrics: counters", "[openmetrics]")
+{
+  enchantum::array<Method, std::uint64_t> values{};
+  values[Method::Get] = 42;
+  values[Method::Delete] = 7;
+
+  char buffer[1024];
+  CHECK(render<Method>(buffer, "requests_total", "method", values, enchantum::metric_type::counter) ==
+        "# TYPE requests counter\n"
+        "requests_total{method=\"Get\"} 42\n"
+        "requests_total{method=\"Put\"} 0\n"
+        "requests_total{method=\"Delete\"} 7\n"
+        "# EOF\n");
+  CHECK(render<Method>(buffer, "requests", "method", values, enchantum::metric_type::counter,
+                       enchantum::metrics_end::more) ==
+        "# TYPE requests counter\n"
+        "requests_total{method=\"Get\"} 42\n"
+        "requests_total{method=\"Put\"} 0\n"
+        "requests_total{method=\"Delete\"} 7\n");
+}
+
+TEST_CASE("write_openmetrics: gauges", "[openmetrics]")
+{
+  enchantum::array<Method, int> values{};
+  values[Method::Put] = -3;
+
+  char buffer[1024];
+  CHECK(render<Method>(buffer, "in_flight", "method", values) ==
+        "# TYPE in_flight gauge\n"
+        "in_flight{method=\"Get\"} 0\n"
+        "in_flight{method=\"Put\"} -3\n"
+        "in_flight{method=\"Delete\"} 0\n"
+        "# EOF\n");
+}
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+TEST_CASE("write_openmetrics: floating point", "[openmetrics]")
+{
+  enchantum::array<Method, double> values{};
+  values[Method::Get]    = 0.25;
+  values[Method::Put]    = std::numeric_limits<double>::infinity();
+  values[Method::Delete] = std::numeric_limits<double>::quiet_NaN();
+
+  char buffer[1024];
+  CHECK(render<Method>(buffer, "load", "method", values) ==
+        "# TYPE load gauge\n"
+        "load{method=\"Get\"} 0.25\n"
+        "load{method=\"Put\"} +Inf\n"
+        "load{method=\"Delete\"} NaN\n"
+        "# EOF\n");
+
+  values[Method::Put] = -std::numeric_limits<double>::infinity();
+  CHECK(render<Method>(buffer, "load", "method", values).find("load{method=\"Put\"} -Inf\n") !=
+        std::string_view::npos);
+}
+#endif
+
+TEST_CASE("write_openmetrics: counter_array snapshot", "[openmetrics]")
+{
+  enchantum::counter_array<Color> counters;
+  counters.add(Color::Green, 3);
+
+  char       buffer[1024];
+  const auto text = render<Color>(buffer, "colors", "color", counters.snapshot());
+  CHECK(text.find("colors{color=\"Green\"} 3\n") != std::string_view::npos);
+  CHECK(text.find("colors{color=\"Red\"} 0\n") != std::string_view::npos);
+}
+
+TEST_CASE("write_openmetrics: histograms", "[openmetrics]")
+{
+  enchantum::array<Method, enchantum::histogram_snapshot<>> values{};
+  auto& h = values[Method::Put];
+  for (const std::uint64_t sample : {3, 3, 1200}) {
+    ++h.buckets[h.bucket_index(sample)];
+    ++h.total;
+    h.sum += sample;
+  }
+
+  const std::uint64_t bounds[]{3, 1000, 1279};
+  char                buffer[1024];
+  const auto          text = render<Method>(buffer, "latency", "q", values, bounds);
+  CHECK(text.find("# TYPE latency histogram\n"
+                  "latency_bucket{q=\"Get\",le=\"3\"} 0\n"
+                  "latency_bucket{q=\"Get\",le=\"1000\"} 0\n"
+                  "latency_bucket{q=\"Get\",le=\"1279\"} 0\n"
+                  "latency_bucket{q=\"Get\",le=\"+Inf\"} 0\n"
+                  "latency_sum{q=\"Get\"} 0\n"
+                  "latency_count{q=\"Get\"} 0\n") == 0);
+  CHECK(text.find("latency_bucket{q=\"Put\",le=\"3\"} 2\n"
+                  "latency_bucket{q=\"Put\",le=\"1000\"} 2\n"
+                  "latency_bucket{q=\"Put\",le=\"1279\"} 3\n"
+                  "latency_bucket{q=\"Put\",le=\"+Inf\"} 3\n"
+                  "latency_sum{q=\"Put\"} 1206\n"
+                  "latency_count{q=\"Put\"} 3\n") != std::string_view::npos);
+  CHECK(text.size() >= 6);
+  CHECK(text.substr(text.size() - 6) == "# EOF\n");
+
+  // every bucket by default so the `le` set does not depend on the samples
+  using snapshot_type = enchantum::histogram_snapshot<>;
+  std::vector<char> all(64 * 1024);
+  const auto [ptr, ec] = enchantum::write_openmetrics(all.data(), all.data() + all.size(), "latency", "q", values);
+  REQUIRE(ec == std::errc{});
+  const std::string_view all_text(all.data(), static_cast<std::size_t>(ptr - all.data()));
+  std::size_t            get_buckets = 0;
+  for (auto at = all_text.find("latency_bucket{q=\"Get\""); at != std::string_view::npos;
+       at      = all_text.find("latency_bucket{q=\"Get\"", at + 1))
+    ++get_buckets;
+  CHECK(get_buckets == snapshot_type::bucket_count + 1);
+  CHECK(all_text.find("latency_bucket{q=\"Put\",le=\"1279\"} 3\n") != std::string_view::npos);
+}
+
+TEST_CASE("write_openmetrics: label escaping", "[openmetrics]")
+{
+  STATIC_CHECK(enchantum::details::render_label_fragment("a\"b\\c\nd", nullptr) == 13);
+  char       out[16]{};
+  const auto size = enchantum::details::render_label_fragment("a\"b\\c\nd", out);
+  CHECK(std::string_view(out, size) == "=\"a\\\"b\\\\c\\nd\"");
+}
+
+TEST_CASE("write_openmetrics: buffer too small", "[openmetrics]")
+{
+  enchantum::array<Color, int> values{};
+  char                         buffer[32];
+  for (std::size_t size = 0; size < sizeof(buffer); ++size) {
+    const auto [ptr, ec] = enchantum::write_openmetrics(buffer, buffer + size, "m", "l", values);
+    CHECK(ec == std::errc::value_too_large);
+    CHECK(ptr == buffer + size);
+  }
+}
@@ -112,4 +112,19 @@ TEST_CASE("scoped::to_string_bitflag")
         "Flags::Flag0|Flags::Flag1|Flags::Flag2|Flags::Flag3|Flags::Flag4|Flags::Flag5|Flags::Flag6");
   CHECK(enchantum::scoped::to_string_bitflag(enchantum::value_ors<Flags>, ',') ==
         "Flags::Flag0,Flags::Flag1,Flags::Flag2,Flags::Flag3,Flags::Flag4,Flags::Flag5,Flags::Flag6");
-}
\ No newline at end of file
+}
+
+TEST_CASE("scoped::cast_bitflag skips spaces around separators")
+{
+  using enchantum::bitflag_spaces;
+  CHECK(enchantum::scoped::cast_bitflag<Flags>("Flags::Flag0 | Flags::Flag2", '|', bitflag_spaces::trim) ==
+        (Flags::Flag0 | Flags::Flag2));
+  CHECK(enchantum::scoped::contains_bitflag<Flags>(" Flags::Flag1 ,Flags::Flag6", ',', bitflag_spaces::trim));
+  CHECK_FALSE(enchantum::scoped::cast_bitflag<Flags>("Flags::Flag0 | Flag2", '|', bitflag_spaces::trim));
+
+  CHECK_FALSE(enchantum::scoped::cast_bitflag<Flags>("Flags::Flag0 | Flags::Flag2"));
+  CHECK_FALSE(enchantum::scoped::contains_bitflag<Flags>(" Flags::Flag1,Flags::Flag6", ','));
+  CHECK(enchantum::scoped::cast_bitflag<Flags>("Flags::Flag0|Flags::Flag2") == (Flags::Flag0 | Flags::Flag2));
+  CHECK_FALSE(enchantum::scoped::cast_bitflag<Flags>("Flags::Flag0|Flag2"));
+  CHECK_FALSE(enchantum::scoped::cast_bitflag<Flags>("Flags::|Flags::Flag2"));
+}
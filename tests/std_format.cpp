@@ -52,3 +52,50 @@ TEST_CASE("Flags enum std::format", "[stringify][std_format]")
     CHECK(std::format("{}", enchantum::value_ors<Flags>) == "Flag0|Flag1|Flag2|Flag3|Flag4|Flag5|Flag6");
   }
 }
+
+TEST_CASE("std::format numbers and format specs", "[stringify][std_format]")
+{
+  CHECK(std::format("{}", Flags{}) == "0");
+  CHECK(std::format("{}", FlagsWithNone::None) == "None");
+  CHECK(std::format("{}", static_cast<Color>(-1000)) == "-1000");
+  CHECK(std::format("{}", static_cast<Color>(32767)) == "32767");
+  CHECK(std::format("[{:>8}]", Color::Red) == "[     Red]");
+  CHECK(std::format("[{:*<13}]", Flags::Flag0 | Flags::Flag4) == "[Flag0|Flag4**]");
+  CHECK(std::format("[{:.3}]", Color::Purple) == "[Pur]");
+}
+
+TEST_CASE("std::format modes", "[stringify][std_format]")
+{
+  CHECK(std::format("{:d}", Color::Green) == "124");
+  CHECK(std::format("{:d}", Color::Aqua) == "-42");
+  CHECK(std::format("{:x}", Color::Red) == "d5");
+  CHECK(std::format("{:X}", Color::Red) == "D5");
+  CHECK(std::format("{:x}", Color::Aqua) == "ffd6");
+  CHECK(std::format("[{:6d}]", Color::Green) == "[   124]");
+  CHECK(std::format("[{:0<6x}]", Color::Red) == "[d50000]");
+
+  CHECK(std::format("{:s}", Color::Green) == "Color::Green");
+  CHECK(std::format("[{:>14s}]", Color::Red) == "[    Color::Red]");
+  CHECK(std::format("[{:^14.8s}]", Color::Red) == "[   Color::R   ]");
+  CHECK(std::format("{:s}", static_cast<Color>(1)) == "1");
+  CHECK(std::format("{:s}", Flags::Flag0 | Flags::Flag4) == "Flags::Flag0|Flags::Flag4");
+  CHECK(std::format("{:s}", FlagsWithNone::None) == "FlagsWithNone::None");
+
+  CHECK(std::format("{:|,}", Flags::Flag0 | Flags::Flag4) == "Flag0,Flag4");
+  CHECK(std::format("{:|}", Flags::Flag0 | Flags::Flag4) == "Flag0|Flag4");
+  CHECK(std::format("[{:-^13|+}]", Flags::Flag1 | Flags::Flag2) == "[-Flag1+Flag2-]");
+  CHECK(std::format("{:|,}", Flags{}) == "0");
+  CHECK(std::format("{:|,}", Flags(200)) == "200");
+
+  // fill followed by an alignment is not a mode
+  CHECK(std::format("[{:d>7}]", Color::Red) == "[ddddRed]");
+  CHECK(std::format("[{:|<7}]", Color::Red) == "[Red||||]");
+}
+
+TEST_CASE("std::format invalid modes", "[stringify][std_format]")
+{
+  const auto value = Color::Red;
+  CHECK_THROWS_AS(std::vformat("{:.3d}", std::make_format_args(value)), std::format_error);
+  CHECK_THROWS_AS(std::vformat("{:|,}", std::make_format_args(value)), std::format_error);
+  CHECK_THROWS_AS(std::vformat("{:{}s}", std::make_format_args(value)), std::format_error);
+}
@@ -0,0 +1,99 @@
+#include "test_utility.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <enchantum/trace.hpp>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+enum class Phase { Parse, Plan, Execute };
+using Schema = enchantum::trace_schema<Color, Phase>;
+
+} // namespace
+
+TEST_CASE("trace_schema: records", "[trace]")
+{
+  STATIC_CHECK(std::is_same_v<Schema::record_type, std::uint8_t>);
+  STATIC_CHECK(Schema::type_id<Color> == 0);
+  STATIC_CHECK(Schema::type_id<Phase> == 1);
+  STATIC_CHECK(std::is_same_v<enchantum::trace_schema<Color, Letters, Phase>::record_type, std::uint8_t>);
+  STATIC_CHECK(std::is_same_v<enchantum::trace_schema<MinMaxValues>::record_type, std::uint8_t>);
+
+  for (const auto color : enchantum::values<Color>) {
+    const auto record = Schema::encode(color);
+    REQUIRE(record);
+    CHECK(Schema::type_id_of(*record) == Schema::type_id<Color>);
+    CHECK(Schema::name_of(*record) == enchantum::to_string(color));
+    CHECK(Schema::type_name_of(*record) == "Color");
+  }
+  const auto execute = Schema::encode(Phase::Execute);
+  REQUIRE(execute);
+  CHECK(Schema::name_of(*execute) == "Execute");
+  CHECK(Schema::type_name_of(*execute) == "Phase");
+
+  CHECK_FALSE(Schema::encode(static_cast<Color>(-1)));
+  CHECK(Schema::name_of(0xFF).size() == 0);
+  CHECK(Schema::type_name_of(0xFF).size() == 0);
+}
+
+TEST_CASE("trace_schema: offline decode", "[trace]")
+{
+  const Schema::record_type records[] = {*Schema::encode(Phase::Parse), *Schema::encode(Color::Red),
+                                         *Schema::encode(Phase::Plan)};
+  std::string               text;
+  Schema::decode(std::begin(records), std::end(records), [&text](const auto type, const auto name) {
+    text.append(type.data(), type.size());
+    text += "::";
+    text.append(name.data(), name.size());
+    text += ' ';
+  });
+  CHECK(text == "Phase::Parse Color::Red Phase::Plan ");
+}
+
+TEST_CASE("trace_ring: push and consume", "[trace]")
+{
+  enchantum::trace_ring<Schema, 4> ring;
+
+  CHECK(ring.push(Phase::Parse));
+  CHECK(ring.push(Color::Green));
+  CHECK_FALSE(ring.push(static_cast<Phase>(7)));
+  CHECK(ring.size() == 2);
+
+  std::vector<std::string_view> names;
+  CHECK(ring.consume_names([&names](auto, const auto name) { names.emplace_back(name.data(), name.size()); }) == 2);
+  CHECK(names == std::vector<std::string_view>{"Parse", "Green"});
+  CHECK(ring.size() == 0);
+
+  for (int i = 0; i < 4; ++i)
+    CHECK(ring.push(Phase::Plan));
+  CHECK_FALSE(ring.push(Phase::Execute));
+  CHECK(ring.dropped() == 1);
+  CHECK(ring.consume([](auto) {}) == 4);
+  CHECK(ring.push(Phase::Execute));
+}
+
+TEST_CASE("trace_ring: producer and consumer threads", "[trace]")
+{
+  enchantum::trace_ring<Schema, 64> ring;
+  constexpr std::size_t             rounds = 20000;
+
+  std::thread producer([&ring] {
+    for (std::size_t i = 0; i < rounds; ++i)
+      while (!ring.push(enchantum::values<Phase>[i % 3])) {}
+  });
+
+  std::size_t received = 0;
+  bool        ordered  = true;
+  while (received != rounds) {
+    ring.consume([&](const Schema::record_type record) {
+      ordered = ordered && Schema::index_of(record) == received % 3;
+      ++received;
+    });
+  }
+  producer.join();
+
+  CHECK(ordered);
+  CHECK(ring.size() == 0);
+}
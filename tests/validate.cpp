@@ -0,0 +1,91 @@
+#include "test_utility.hpp"
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <enchantum/validate.hpp>
+#include <vector>
+
+namespace {
+
+enum class Contiguous32 : std::int32_t {
+  A = -3,
+  B,
+  C,
+  D,
+  E,
+  F,
+};
+
+enum class Flags32 : std::uint32_t {
+  None = 0,
+  A    = 1 << 0,
+  B    = 1 << 1,
+  C    = 1 << 2,
+  D    = 1 << 3,
+};
+ENCHANTUM_DEFINE_BITWISE_FOR(Flags32)
+
+enum class Sparse32 : std::int32_t {
+  A = -200,
+  B = -7,
+  C = 0,
+  D = 31,
+  E = 32,
+  F = 33,
+  G = 100,
+  H = 255,
+};
+
+} // namespace
+
+template<typename E>
+std::vector<std::underlying_type_t<E>> validate_inputs()
+{
+  using T = std::underlying_type_t<E>;
+  std::vector<T> inputs;
+  for (int round = 0; round < 5; ++round)
+    for (const auto e : enchantum::values<E>)
+      inputs.push_back(static_cast<T>(e));
+  return inputs;
+}
+
+using ValidateTestTypes = type_list<Contiguous32, Flags32, Sparse32, Color, Flags, UnscopedColor>;
+
+TEMPLATE_LIST_TEST_CASE("validate finds the first invalid value", "[validate]", ValidateTestTypes)
+{
+  using T          = std::underlying_type_t<TestType>;
+  const auto valid = validate_inputs<TestType>();
+  CHECK(enchantum::validate<TestType>(valid) == valid.size());
+
+  const T invalids[] = {static_cast<T>(enchantum::to_underlying(enchantum::max<TestType>) + 1),
+                        static_cast<T>(enchantum::to_underlying(enchantum::min<TestType>) - 1),
+                        static_cast<T>(3),
+                        static_cast<T>(-1)};
+  for (const auto invalid : invalids) {
+    if (enchantum::contains<TestType>(invalid))
+      continue;
+    for (std::size_t at = 0; at < valid.size(); ++at) {
+      auto values = valid;
+      values[at]  = invalid;
+      CHECK(enchantum::validate<TestType>(values) == at);
+
+      std::vector<std::uint64_t> mask((values.size() + 63) / 64);
+      enchantum::validate_mask<TestType>(values, mask);
+      for (std::size_t i = 0; i < values.size(); ++i)
+        CHECK(((mask[i / 64] >> (i % 64)) & 1) == std::uint64_t{i != at});
+    }
+  }
+}
+
+TEST_CASE("validate in constant evaluation", "[validate]")
+{
+  STATIC_CHECK(enchantum::index_layout<Contiguous32> == enchantum::index_layout_mode::contiguous);
+  STATIC_CHECK(enchantum::index_layout<Flags32> == enchantum::index_layout_mode::contiguous_bitflag);
+  STATIC_CHECK(enchantum::index_layout<Sparse32> == enchantum::index_layout_mode::rank_bitmap);
+
+  constexpr std::int32_t values[] = {-3, -2, 2, 1, 0, -1, 2, 3, 1, -3};
+  STATIC_CHECK(enchantum::validate<Contiguous32>(values) == 7);
+
+  constexpr Sparse32 sparse[] = {Sparse32::A, Sparse32::H, static_cast<Sparse32>(34)};
+  STATIC_CHECK(enchantum::validate<Sparse32>(sparse) == 2);
+}